@@ -0,0 +1,71 @@
+#include <benchmark/benchmark.h>
+#include "../include/LinkedList.hpp"
+#include "../include/PoolAllocator.hpp"
+
+#include <memory_resource>
+
+// Стоимость диспетчеризации выделения узлов: один и тот же NodePool
+// за виртуальным memory_resource (pmr) и за статическим PoolAllocator
+
+class NodePoolResource : public std::pmr::memory_resource {
+private:
+    NodePool* _pool;
+
+public:
+    explicit NodePoolResource(NodePool* pool) : _pool(pool) {}
+
+protected:
+    void* do_allocate(size_t bytes, size_t) override {
+        return this->_pool->allocate(bytes);
+    }
+
+    void do_deallocate(void* ptr, size_t bytes, size_t) override {
+        this->_pool->deallocate(ptr, bytes);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+};
+
+template <typename ListType, typename AllocatorType>
+static void pushPopCycle(benchmark::State& state, AllocatorType alloc) {
+    ListType list(alloc);
+    int count = static_cast<int>(state.range(0));
+
+    for (auto _ : state) {
+        for (int i = 0; i < count; ++i) {
+            list.pushFront(i);
+        }
+        for (int i = 0; i < count; ++i) {
+            benchmark::DoNotOptimize(list.popFront());
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * count * 2);
+}
+
+static void BM_PushPopVirtualDispatch(benchmark::State& state) {
+    NodePool pool;
+    NodePoolResource resource(&pool);
+    using Allocator = std::pmr::polymorphic_allocator<ListItem<int>>;
+
+    pushPopCycle<LinkedList<int, Allocator>>(state, Allocator(&resource));
+}
+BENCHMARK(BM_PushPopVirtualDispatch)->RangeMultiplier(10)->Range(10, 100000);
+
+static void BM_PushPopStaticDispatch(benchmark::State& state) {
+    NodePool pool;
+    using Allocator = PoolAllocator<int>;
+
+    pushPopCycle<LinkedList<int, Allocator>>(state, Allocator(&pool));
+}
+BENCHMARK(BM_PushPopStaticDispatch)->RangeMultiplier(10)->Range(10, 100000);
+
+static void BM_PushPopUnsynchronizedPool(benchmark::State& state) {
+    std::pmr::unsynchronized_pool_resource resource;
+    using Allocator = std::pmr::polymorphic_allocator<ListItem<int>>;
+
+    pushPopCycle<LinkedList<int, Allocator>>(state, Allocator(&resource));
+}
+BENCHMARK(BM_PushPopUnsynchronizedPool)->RangeMultiplier(10)->Range(10, 100000);
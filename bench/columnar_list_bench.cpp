@@ -0,0 +1,170 @@
+#include <benchmark/benchmark.h>
+#include "../include/ColumnarList.hpp"
+#include "../include/LinkedList.hpp"
+
+#include <cmath>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+// Агрегаты по полям структур: узловой LinkedList против столбцового ColumnarList.
+// В узлах x, y, z перемежаются со ссылками, и цикл идёт по указателям;
+// в столбцах значения поля лежат подряд
+
+struct Point3D {
+    double x, y, z;
+
+    double distance() const {
+        return std::sqrt(x * x + y * y + z * z);
+    }
+};
+
+struct Student {
+    std::string name;
+    int age;
+    double gpa;
+};
+
+template <>
+struct ColumnarLayout<Point3D> {
+    static constexpr auto fields = std::make_tuple(&Point3D::x, &Point3D::y, &Point3D::z);
+};
+
+template <>
+struct ColumnarLayout<Student> {
+    static constexpr auto fields = std::make_tuple(&Student::name, &Student::age, &Student::gpa);
+};
+
+using PointList = LinkedList<Point3D, std::pmr::polymorphic_allocator<ListItem<Point3D>>>;
+using StudentList = LinkedList<Student, std::pmr::polymorphic_allocator<ListItem<Student>>>;
+
+static Point3D makePoint(size_t i) {
+    return Point3D{double(i), double(i % 7), double(i % 13)};
+}
+
+static Student makeStudent(size_t i) {
+    return Student{"student", int(18 + i % 10), 2.0 + double(i % 21) / 10.0};
+}
+
+static void BM_NodeDistances(benchmark::State& state) {
+    std::pmr::unsynchronized_pool_resource resource;
+    PointList list{std::pmr::polymorphic_allocator<ListItem<Point3D>>(&resource)};
+    size_t count = static_cast<size_t>(state.range(0));
+
+    for (size_t i = 0; i < count; ++i) {
+        Point3D point = makePoint(i);
+        list.pushBack(point);
+    }
+
+    std::vector<double> norms(count);
+    for (auto _ : state) {
+        size_t idx = 0;
+        for (auto it = list.begin(); it != list.end(); ++it) {
+            norms[idx++] = (*it).distance();
+        }
+        benchmark::DoNotOptimize(norms.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_NodeDistances)->Range(1 << 10, 1 << 20);
+
+static void BM_ColumnarDistances(benchmark::State& state) {
+    ColumnarList<Point3D> list;
+    size_t count = static_cast<size_t>(state.range(0));
+
+    for (size_t i = 0; i < count; ++i) {
+        list.pushBack(makePoint(i));
+    }
+
+    std::vector<double> norms;
+    for (auto _ : state) {
+        columnNorms<&Point3D::x, &Point3D::y, &Point3D::z>(list, norms);
+        benchmark::DoNotOptimize(norms.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_ColumnarDistances)->Range(1 << 10, 1 << 20);
+
+static void BM_NodeGpaSum(benchmark::State& state) {
+    std::pmr::unsynchronized_pool_resource resource;
+    StudentList list{std::pmr::polymorphic_allocator<ListItem<Student>>(&resource)};
+    size_t count = static_cast<size_t>(state.range(0));
+
+    for (size_t i = 0; i < count; ++i) {
+        Student student = makeStudent(i);
+        list.pushBack(student);
+    }
+
+    for (auto _ : state) {
+        double total = 0.0;
+        for (auto it = list.begin(); it != list.end(); ++it) {
+            total += (*it).gpa;
+        }
+        benchmark::DoNotOptimize(total);
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_NodeGpaSum)->Range(1 << 10, 1 << 20);
+
+static void BM_ColumnarGpaSum(benchmark::State& state) {
+    ColumnarList<Student> list;
+    size_t count = static_cast<size_t>(state.range(0));
+
+    for (size_t i = 0; i < count; ++i) {
+        list.pushBack(makeStudent(i));
+    }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(columnSum<&Student::gpa>(list));
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_ColumnarGpaSum)->Range(1 << 10, 1 << 20);
+
+static void BM_NodeGpaFilter(benchmark::State& state) {
+    std::pmr::unsynchronized_pool_resource resource;
+    StudentList list{std::pmr::polymorphic_allocator<ListItem<Student>>(&resource)};
+    size_t count = static_cast<size_t>(state.range(0));
+
+    for (size_t i = 0; i < count; ++i) {
+        Student student = makeStudent(i);
+        list.pushBack(student);
+    }
+
+    std::vector<size_t> selected;
+    for (auto _ : state) {
+        selected.clear();
+        size_t idx = 0;
+        for (auto it = list.begin(); it != list.end(); ++it, ++idx) {
+            if ((*it).gpa > 3.5) {
+                selected.push_back(idx);
+            }
+        }
+        benchmark::DoNotOptimize(selected.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_NodeGpaFilter)->Range(1 << 10, 1 << 20);
+
+static void BM_ColumnarGpaFilter(benchmark::State& state) {
+    ColumnarList<Student> list;
+    size_t count = static_cast<size_t>(state.range(0));
+
+    for (size_t i = 0; i < count; ++i) {
+        list.pushBack(makeStudent(i));
+    }
+
+    std::vector<size_t> selected;
+    for (auto _ : state) {
+        columnSelect<&Student::gpa>(list, [](double gpa) { return gpa > 3.5; }, selected);
+        benchmark::DoNotOptimize(selected.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_ColumnarGpaFilter)->Range(1 << 10, 1 << 20);
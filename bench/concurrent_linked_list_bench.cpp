@@ -0,0 +1,102 @@
+#include <benchmark/benchmark.h>
+#include "../include/ConcurrentLinkedList.hpp"
+#include "../include/LinkedList.hpp"
+
+#include <atomic>
+#include <memory_resource>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Пропускная способность общего стека при разном числе производителей
+// (args[0]) и потребителей (args[1]): lock-free список против LinkedList под мьютексом
+
+constexpr int OPERATIONS_PER_PRODUCER = 200000;
+
+template <typename PushFunc, typename PopFunc>
+static void runProducersConsumers(benchmark::State& state, PushFunc push, PopFunc pop) {
+    int producerCount = static_cast<int>(state.range(0));
+    int consumerCount = static_cast<int>(state.range(1));
+    int totalItems = producerCount * OPERATIONS_PER_PRODUCER;
+
+    std::atomic<int> consumed(0);
+    std::vector<std::thread> threads;
+
+    for (int p = 0; p < producerCount; ++p) {
+        threads.emplace_back([&push]() {
+            for (int i = 0; i < OPERATIONS_PER_PRODUCER; ++i) {
+                push(i);
+            }
+        });
+    }
+
+    for (int c = 0; c < consumerCount; ++c) {
+        threads.emplace_back([&pop, &consumed, totalItems]() {
+            while (consumed.load(std::memory_order_relaxed) < totalItems) {
+                if (pop()) {
+                    consumed.fetch_add(1, std::memory_order_relaxed);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+static void BM_LockFreeStack(benchmark::State& state) {
+    std::pmr::synchronized_pool_resource pool;
+
+    for (auto _ : state) {
+        ConcurrentLinkedList<int> list{std::pmr::polymorphic_allocator<int>(&pool)};
+
+        runProducersConsumers(state,
+            [&list](int value) {
+                list.pushFront(value);
+            },
+            [&list]() {
+                int value = 0;
+                return list.tryPopFront(value);
+            }
+        );
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0) * OPERATIONS_PER_PRODUCER * 2);
+}
+
+static void BM_MutexLinkedList(benchmark::State& state) {
+    std::pmr::synchronized_pool_resource pool;
+    using IntList = LinkedList<int, std::pmr::polymorphic_allocator<ListItem<int>>>;
+
+    for (auto _ : state) {
+        IntList list{std::pmr::polymorphic_allocator<ListItem<int>>(&pool)};
+        std::mutex listMutex;
+
+        runProducersConsumers(state,
+            [&list, &listMutex](int value) {
+                std::lock_guard<std::mutex> lock(listMutex);
+                list.pushFront(value);
+            },
+            [&list, &listMutex]() {
+                std::lock_guard<std::mutex> lock(listMutex);
+                if (list.isEmpty()) {
+                    return false;
+                }
+                list.popFront();
+                return true;
+            }
+        );
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0) * OPERATIONS_PER_PRODUCER * 2);
+}
+
+#define PRODUCER_CONSUMER_ARGS \
+    ->Args({1, 1})->Args({2, 2})->Args({4, 4})->Args({1, 4})->Args({4, 1}) \
+    ->UseRealTime()->Unit(benchmark::kMillisecond)
+
+BENCHMARK(BM_LockFreeStack) PRODUCER_CONSUMER_ARGS;
+BENCHMARK(BM_MutexLinkedList) PRODUCER_CONSUMER_ARGS;
@@ -0,0 +1,132 @@
+#include <benchmark/benchmark.h>
+#include "../include/LinkedList.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <memory_resource>
+#include <random>
+#include <vector>
+
+// Сравнение сортировки перевязкой узлов с копированием в std::vector
+
+using IntAllocator = std::pmr::polymorphic_allocator<ListItem<int>>;
+using IntList = LinkedList<int, IntAllocator>;
+
+static void fillRandom(IntList& list, std::mt19937& rng) {
+    for (auto it = list.begin(); it != list.end(); ++it) {
+        *it = static_cast<int>(rng());
+    }
+}
+
+static void BM_ListSortInPlace(benchmark::State& state) {
+    std::pmr::unsynchronized_pool_resource pool;
+    IntList list(static_cast<size_t>(state.range(0)), IntAllocator(&pool));
+    std::mt19937 rng(42);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        fillRandom(list, rng);
+        state.ResumeTiming();
+
+        list.sort();
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ListSortInPlace)->RangeMultiplier(10)->Range(1000, 1000000);
+
+static void BM_ListSortViaVector(benchmark::State& state) {
+    std::pmr::unsynchronized_pool_resource pool;
+    IntList list(static_cast<size_t>(state.range(0)), IntAllocator(&pool));
+    std::mt19937 rng(42);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        fillRandom(list, rng);
+        state.ResumeTiming();
+
+        std::vector<int> values;
+        values.reserve(list.getSize());
+        for (auto it = list.begin(); it != list.end(); ++it) {
+            values.push_back(*it);
+        }
+
+        std::stable_sort(values.begin(), values.end());
+
+        auto valueIt = values.begin();
+        for (auto it = list.begin(); it != list.end(); ++it, ++valueIt) {
+            *it = *valueIt;
+        }
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ListSortViaVector)->RangeMultiplier(10)->Range(1000, 1000000);
+
+static void BM_ListReverse(benchmark::State& state) {
+    std::pmr::unsynchronized_pool_resource pool;
+    IntList list(static_cast<size_t>(state.range(0)), IntAllocator(&pool));
+
+    for (auto _ : state) {
+        list.reverse();
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ListReverse)->RangeMultiplier(10)->Range(1000, 1000000);
+
+static void BM_ListUnique(benchmark::State& state) {
+    std::pmr::unsynchronized_pool_resource pool;
+    std::vector<int> values(static_cast<size_t>(state.range(0)));
+    for (size_t i = 0; i < values.size(); ++i) {
+        values[i] = static_cast<int>(i / 2);
+    }
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto list = std::make_unique<IntList>(IntAllocator(&pool));
+        list->append(values.begin(), values.end());
+        state.ResumeTiming();
+
+        benchmark::DoNotOptimize(list->unique());
+
+        state.PauseTiming();
+        list.reset();
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ListUnique)->RangeMultiplier(10)->Range(1000, 100000);
+
+// Освобождение списка: обход узлов против возврата блоков целиком
+template <typename ListType>
+static void clearList(benchmark::State& state) {
+    std::pmr::unsynchronized_pool_resource pool;
+    ListType list{IntAllocator(&pool)};
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        for (int i = 0; i < state.range(0); ++i) {
+            list.pushBack(i);
+        }
+        state.ResumeTiming();
+
+        list.clear();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_ListClearPerNode(benchmark::State& state) {
+    clearList<LinkedList<int, IntAllocator, PerNodeAllocation>>(state);
+}
+BENCHMARK(BM_ListClearPerNode)->RangeMultiplier(10)->Range(1000, 1000000);
+
+static void BM_ListClearSlab(benchmark::State& state) {
+    clearList<LinkedList<int, IntAllocator, SlabAllocation>>(state);
+}
+BENCHMARK(BM_ListClearSlab)->RangeMultiplier(10)->Range(1000, 1000000);
@@ -0,0 +1,660 @@
+#include <benchmark/benchmark.h>
+#include "../include/AdaptiveList.hpp"
+#include "../include/HotColdList.hpp"
+#include "../include/IntrusiveList.hpp"
+#include "../include/LinkedList.hpp"
+#include "../include/MemoryResource.hpp"
+
+#include <algorithm>
+#include <forward_list>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+// Базовый набор измерений LinkedList против std::forward_list и
+// std::pmr::forward_list на monotonic_buffer_resource и
+// unsynchronized_pool_resource. Каждый контейнер обёрнут в Harness с
+// одинаковым интерфейсом; ресурс создаётся вместе с контейнером, поэтому
+// стоимость ресурса входит в замер.
+//
+// Результаты в JSON для сравнения между версиями: цель bench_json.
+
+struct Book {
+    std::string title;
+    std::string author;
+    int year;
+    int pages;
+};
+
+template <typename T>
+T makeValue(size_t i);
+
+template <>
+int makeValue<int>(size_t i) {
+    return static_cast<int>(i);
+}
+
+template <>
+std::string makeValue<std::string>(size_t i) {
+    return "benchmark value beyond small string " + std::to_string(i);
+}
+
+template <>
+Book makeValue<Book>(size_t i) {
+    return Book{"The C++ Programming Language", "Bjarne Stroustrup", 2013, static_cast<int>(i)};
+}
+
+template <typename T>
+void consume(const T& value) {
+    benchmark::DoNotOptimize(&value);
+}
+
+// ============ Обёртки контейнеров ============
+template <typename T, typename ResourceType, typename AllocationPolicy = PerNodeAllocation>
+class LinkedListHarness {
+private:
+    using AllocatorType = std::pmr::polymorphic_allocator<ListItem<T>>;
+
+    ResourceType _resource;
+    LinkedList<T, AllocatorType, AllocationPolicy> _list;
+
+public:
+    LinkedListHarness() : _resource(), _list(AllocatorType(&this->_resource)) {}
+
+    explicit LinkedListHarness(size_t count) : _resource(), _list(count, AllocatorType(&this->_resource)) {}
+
+    void pushFront(T value) {
+        this->_list.pushFront(value);
+    }
+
+    void pushBack(T value) {
+        this->_list.pushBack(value);
+    }
+
+    void popFront() {
+        consume(this->_list.popFront());
+    }
+
+    void popBack() {
+        consume(this->_list.popBack());
+    }
+
+    void at(size_t idx) {
+        consume(this->_list[idx].value);
+    }
+
+    void traverse() {
+        for (auto it = this->_list.begin(); it != this->_list.end(); ++it) {
+            consume(*it);
+        }
+    }
+};
+
+template <typename T>
+class ForwardListHarness {
+private:
+    std::forward_list<T> _list;
+    typename std::forward_list<T>::iterator _tail;
+
+public:
+    ForwardListHarness() : _list(), _tail(_list.before_begin()) {}
+
+    explicit ForwardListHarness(size_t count) : _list(count), _tail() {}
+
+    void pushFront(T value) {
+        bool wasEmpty = this->_list.empty();
+        this->_list.push_front(std::move(value));
+        if (wasEmpty) {
+            this->_tail = this->_list.begin();
+        }
+    }
+
+    void pushBack(T value) {
+        this->_tail = this->_list.insert_after(this->_tail, std::move(value));
+    }
+
+    void popFront() {
+        consume(this->_list.front());
+        this->_list.pop_front();
+    }
+
+    void at(size_t idx) {
+        consume(*std::next(this->_list.begin(), static_cast<std::ptrdiff_t>(idx)));
+    }
+
+    void traverse() {
+        for (const T& value : this->_list) {
+            consume(value);
+        }
+    }
+};
+
+template <typename T, typename ResourceType>
+class PmrForwardListHarness {
+private:
+    ResourceType _resource;
+    std::pmr::forward_list<T> _list;
+    typename std::pmr::forward_list<T>::iterator _tail;
+
+public:
+    PmrForwardListHarness() : _resource(), _list(&this->_resource), _tail(_list.before_begin()) {}
+
+    explicit PmrForwardListHarness(size_t count) : _resource(), _list(count, &this->_resource), _tail() {}
+
+    void pushFront(T value) {
+        bool wasEmpty = this->_list.empty();
+        this->_list.push_front(std::move(value));
+        if (wasEmpty) {
+            this->_tail = this->_list.begin();
+        }
+    }
+
+    void pushBack(T value) {
+        this->_tail = this->_list.insert_after(this->_tail, std::move(value));
+    }
+
+    void popFront() {
+        consume(this->_list.front());
+        this->_list.pop_front();
+    }
+
+    void at(size_t idx) {
+        consume(*std::next(this->_list.begin(), static_cast<std::ptrdiff_t>(idx)));
+    }
+
+    void traverse() {
+        for (const T& value : this->_list) {
+            consume(value);
+        }
+    }
+};
+
+// ============ Замеры ============
+// Заполнение и уничтожение контейнера
+template <typename Harness, typename T>
+static void BM_PushFront(benchmark::State& state) {
+    size_t count = static_cast<size_t>(state.range(0));
+
+    for (auto _ : state) {
+        Harness harness;
+        for (size_t i = 0; i < count; ++i) {
+            harness.pushFront(makeValue<T>(i));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+template <typename Harness, typename T>
+static void BM_PushBack(benchmark::State& state) {
+    size_t count = static_cast<size_t>(state.range(0));
+
+    for (auto _ : state) {
+        Harness harness;
+        for (size_t i = 0; i < count; ++i) {
+            harness.pushBack(makeValue<T>(i));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+template <typename Harness, typename T>
+static void BM_PopFront(benchmark::State& state) {
+    size_t count = static_cast<size_t>(state.range(0));
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto harness = std::make_unique<Harness>();
+        for (size_t i = 0; i < count; ++i) {
+            harness->pushFront(makeValue<T>(i));
+        }
+        state.ResumeTiming();
+
+        for (size_t i = 0; i < count; ++i) {
+            harness->popFront();
+        }
+
+        state.PauseTiming();
+        harness.reset();
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+// popBack у LinkedList - O(n), у forward_list его нет
+template <typename Harness, typename T>
+static void BM_PopBack(benchmark::State& state) {
+    size_t count = static_cast<size_t>(state.range(0));
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto harness = std::make_unique<Harness>();
+        for (size_t i = 0; i < count; ++i) {
+            harness->pushFront(makeValue<T>(i));
+        }
+        state.ResumeTiming();
+
+        for (size_t i = 0; i < count; ++i) {
+            harness->popBack();
+        }
+
+        state.PauseTiming();
+        harness.reset();
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+// Доступ по индексу ко всем элементам: O(n^2)
+template <typename Harness, typename T>
+static void BM_IndexAccess(benchmark::State& state) {
+    size_t count = static_cast<size_t>(state.range(0));
+    Harness harness;
+    for (size_t i = 0; i < count; ++i) {
+        harness.pushFront(makeValue<T>(i));
+    }
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < count; ++i) {
+            harness.at(i);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+template <typename Harness, typename T>
+static void BM_Traverse(benchmark::State& state) {
+    size_t count = static_cast<size_t>(state.range(0));
+    Harness harness;
+    for (size_t i = 0; i < count; ++i) {
+        harness.pushFront(makeValue<T>(i));
+    }
+
+    for (auto _ : state) {
+        harness.traverse();
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+// Конструктор размера и деструктор
+template <typename Harness, typename T>
+static void BM_ConstructDestroy(benchmark::State& state) {
+    size_t count = static_cast<size_t>(state.range(0));
+
+    for (auto _ : state) {
+        Harness harness(count);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+// ============ Регистрация ============
+// Линейные операции - от 10 до 1M элементов, квадратичные - до 10K
+#define LINEAR_SIZES RangeMultiplier(10)->Range(10, 1000000)
+#define QUADRATIC_SIZES RangeMultiplier(10)->Range(10, 10000)
+
+#define REGISTER_COMMON(Harness, T)                                                   \
+    BENCHMARK_TEMPLATE(BM_PushFront, Harness, T)->LINEAR_SIZES;                      \
+    BENCHMARK_TEMPLATE(BM_PushBack, Harness, T)->LINEAR_SIZES;                       \
+    BENCHMARK_TEMPLATE(BM_PopFront, Harness, T)->LINEAR_SIZES;                       \
+    BENCHMARK_TEMPLATE(BM_IndexAccess, Harness, T)->QUADRATIC_SIZES;                 \
+    BENCHMARK_TEMPLATE(BM_Traverse, Harness, T)->LINEAR_SIZES;                       \
+    BENCHMARK_TEMPLATE(BM_ConstructDestroy, Harness, T)->LINEAR_SIZES;
+
+#define REGISTER_LINKED_LIST(Harness, T)                                              \
+    REGISTER_COMMON(Harness, T)                                                       \
+    BENCHMARK_TEMPLATE(BM_PopBack, Harness, T)->QUADRATIC_SIZES;
+
+#define REGISTER_TYPE(T, Name)                                                                          \
+    using Name##ListPool = LinkedListHarness<T, std::pmr::unsynchronized_pool_resource>;                \
+    using Name##ListMonotonic = LinkedListHarness<T, std::pmr::monotonic_buffer_resource>;              \
+    using Name##SlabListPool = LinkedListHarness<T, std::pmr::unsynchronized_pool_resource, SlabAllocation>; \
+    using Name##ForwardList = ForwardListHarness<T>;                                                    \
+    using Name##PmrForwardListPool = PmrForwardListHarness<T, std::pmr::unsynchronized_pool_resource>;  \
+    using Name##PmrForwardListMonotonic = PmrForwardListHarness<T, std::pmr::monotonic_buffer_resource>; \
+    REGISTER_LINKED_LIST(Name##ListPool, T)                                                             \
+    REGISTER_LINKED_LIST(Name##ListMonotonic, T)                                                        \
+    REGISTER_LINKED_LIST(Name##SlabListPool, T)                                                         \
+    REGISTER_COMMON(Name##ForwardList, T)                                                               \
+    REGISTER_COMMON(Name##PmrForwardListPool, T)                                                        \
+    REGISTER_COMMON(Name##PmrForwardListMonotonic, T)
+
+REGISTER_TYPE(int, Int)
+REGISTER_TYPE(std::string, String)
+REGISTER_TYPE(Book, Book)
+
+// ============ MemoryResource ============
+// Буфер MemoryResource - 5000 байт, поэтому размеры малы
+static void BM_MemoryResourceAllocate(benchmark::State& state) {
+    MemoryResource mres;
+    size_t count = static_cast<size_t>(state.range(0));
+    std::vector<void*> blocks(count);
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < count; ++i) {
+            blocks[i] = mres.allocate(16);
+        }
+        for (size_t i = 0; i < count; ++i) {
+            mres.deallocate(blocks[i], 16);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_MemoryResourceAllocate)->Arg(10)->Arg(100)->Arg(250);
+
+static void BM_MemoryResourceListPushPop(benchmark::State& state) {
+    MemoryResource mres;
+    LinkedList<int, std::pmr::polymorphic_allocator<ListItem<int>>> list(&mres);
+    int count = static_cast<int>(state.range(0));
+
+    for (auto _ : state) {
+        for (int i = 0; i < count; ++i) {
+            list.pushFront(i);
+        }
+        for (int i = 0; i < count; ++i) {
+            benchmark::DoNotOptimize(list.popFront());
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * count * 2);
+}
+BENCHMARK(BM_MemoryResourceListPushPop)->Arg(10)->Arg(100)->Arg(250);
+
+// Удаление половины элементов: eraseAfter по одному узлу против removeIf,
+// возвращающего память пакетами
+static void BM_MemoryResourcePurgeEraseAfter(benchmark::State& state) {
+    MemoryResource mres;
+    LinkedList<int, std::pmr::polymorphic_allocator<ListItem<int>>> list(&mres);
+    int count = static_cast<int>(state.range(0));
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        for (int i = 0; i < count; ++i) {
+            list.pushFront(i);
+        }
+        state.ResumeTiming();
+
+        for (auto it = list.beforeBegin(); std::next(it) != list.end(); ++it) {
+            list.eraseAfter(it);
+        }
+
+        state.PauseTiming();
+        list.clear();
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_MemoryResourcePurgeEraseAfter)->Arg(100)->Arg(250);
+
+static void BM_MemoryResourcePurgeRemoveIf(benchmark::State& state) {
+    MemoryResource mres;
+    LinkedList<int, std::pmr::polymorphic_allocator<ListItem<int>>> list(&mres);
+    int count = static_cast<int>(state.range(0));
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        for (int i = 0; i < count; ++i) {
+            list.pushFront(i);
+        }
+        state.ResumeTiming();
+
+        list.removeIf([](int value) { return value % 2 == 1; });
+
+        state.PauseTiming();
+        list.clear();
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_MemoryResourcePurgeRemoveIf)->Arg(100)->Arg(250);
+
+// Маленькие списки, как в main.cpp: со встроенными узлами аллокатор не вызывается
+template <typename AllocationPolicy>
+static void BM_MemoryResourceSmallList(benchmark::State& state) {
+    MemoryResource mres;
+    std::pmr::polymorphic_allocator<ListItem<int>> alloc(&mres);
+
+    for (auto _ : state) {
+        LinkedList<int, std::pmr::polymorphic_allocator<ListItem<int>>, AllocationPolicy> list({10, 20, 30, 40, 50}, alloc);
+        int value = 60;
+        list.pushBack(value);
+        benchmark::DoNotOptimize(list.popFront());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_TEMPLATE(BM_MemoryResourceSmallList, PerNodeAllocation);
+BENCHMARK_TEMPLATE(BM_MemoryResourceSmallList, InlineAllocation<8>);
+
+// Очередь устойчивого размера: узлы из кэша списка не проходят через MemoryResource
+template <typename AllocationPolicy>
+static void BM_MemoryResourceQueueChurn(benchmark::State& state) {
+    MemoryResource mres;
+    std::pmr::polymorphic_allocator<ListItem<int>> alloc(&mres);
+    LinkedList<int, std::pmr::polymorphic_allocator<ListItem<int>>, AllocationPolicy> list(alloc);
+    int count = static_cast<int>(state.range(0));
+    for (int i = 0; i < count; ++i) {
+        list.pushBack(i);
+    }
+
+    int value = 0;
+    for (auto _ : state) {
+        list.pushBack(value++);
+        benchmark::DoNotOptimize(list.popFront());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_TEMPLATE(BM_MemoryResourceQueueChurn, PerNodeAllocation)->Arg(10)->Arg(100);
+BENCHMARK_TEMPLATE(BM_MemoryResourceQueueChurn, RecyclingAllocation<64>)->Arg(10)->Arg(100);
+
+// ============ Поиск по ключу ============
+// Поиск записи по ключу: линейный обход против хеш-индекса списка
+template <typename IndexPolicy>
+using BookList = LinkedList<Book, std::pmr::polymorphic_allocator<ListItem<Book>>, PerNodeAllocation, IndexPolicy>;
+
+static void BM_FindBookLinear(benchmark::State& state) {
+    size_t count = static_cast<size_t>(state.range(0));
+    std::pmr::unsynchronized_pool_resource pool;
+    BookList<NoIndex> list{std::pmr::polymorphic_allocator<ListItem<Book>>(&pool)};
+    for (size_t i = 0; i < count; ++i) {
+        list.pushBack(makeValue<Book>(i));
+    }
+
+    int key = 0;
+    for (auto _ : state) {
+        auto found = std::ranges::find(list, key, &Book::pages);
+        benchmark::DoNotOptimize(found);
+        key = (key + 7919) % static_cast<int>(count);
+    }
+}
+BENCHMARK(BM_FindBookLinear)->RangeMultiplier(10)->Range(10, 100000);
+
+static void BM_FindBookIndexed(benchmark::State& state) {
+    size_t count = static_cast<size_t>(state.range(0));
+    std::pmr::unsynchronized_pool_resource pool;
+    BookList<HashIndex<&Book::pages>> list{std::pmr::polymorphic_allocator<ListItem<Book>>(&pool)};
+    for (size_t i = 0; i < count; ++i) {
+        list.pushBack(makeValue<Book>(i));
+    }
+
+    int key = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(list.find(key));
+        key = (key + 7919) % static_cast<int>(count);
+    }
+}
+BENCHMARK(BM_FindBookIndexed)->RangeMultiplier(10)->Range(10, 100000);
+
+// ============ Интрузивный список ============
+// Очередь записей, которыми владеет пул: узел-обёртка с копией записи
+// против крючка внутри самой записи
+struct PooledBook : public IntrusiveListHook {
+    Book book;
+};
+
+static void BM_QueuePooledBooksLinkedList(benchmark::State& state) {
+    size_t count = static_cast<size_t>(state.range(0));
+    std::pmr::unsynchronized_pool_resource pool;
+    LinkedList<Book, std::pmr::polymorphic_allocator<ListItem<Book>>> list{std::pmr::polymorphic_allocator<ListItem<Book>>(&pool)};
+    std::vector<Book> books(count, makeValue<Book>(0));
+
+    for (auto _ : state) {
+        for (Book& book : books) {
+            list.pushBack(book);
+        }
+        while (!list.isEmpty()) {
+            benchmark::DoNotOptimize(list.popFront());
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_QueuePooledBooksLinkedList)->RangeMultiplier(10)->Range(10, 100000);
+
+static void BM_QueuePooledBooksIntrusive(benchmark::State& state) {
+    size_t count = static_cast<size_t>(state.range(0));
+    IntrusiveList<PooledBook> list;
+    std::vector<PooledBook> books(count, PooledBook{{}, makeValue<Book>(0)});
+
+    for (auto _ : state) {
+        for (PooledBook& book : books) {
+            list.pushBack(book);
+        }
+        while (!list.isEmpty()) {
+            benchmark::DoNotOptimize(&list.popFront());
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_QueuePooledBooksIntrusive)->RangeMultiplier(10)->Range(10, 100000);
+
+// ============ Переприсваивание списков ============
+// Поворот трёх списков на общем ресурсе: обмен за O(1) против пересборки копией
+static void BM_RotateListsSwap(benchmark::State& state) {
+    size_t count = static_cast<size_t>(state.range(0));
+    std::pmr::unsynchronized_pool_resource pool;
+    std::pmr::polymorphic_allocator<ListItem<int>> alloc(&pool);
+    using ListType = LinkedList<int, std::pmr::polymorphic_allocator<ListItem<int>>>;
+
+    ListType lists[3] = {ListType(count, alloc), ListType(count, alloc), ListType(count, alloc)};
+    for (auto _ : state) {
+        lists[0].swap(lists[1]);
+        lists[1].swap(lists[2]);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_RotateListsSwap)->RangeMultiplier(10)->Range(10, 100000);
+
+static void BM_RotateListsRebuild(benchmark::State& state) {
+    size_t count = static_cast<size_t>(state.range(0));
+    std::pmr::unsynchronized_pool_resource pool;
+    std::pmr::polymorphic_allocator<ListItem<int>> alloc(&pool);
+    using ListType = LinkedList<int, std::pmr::polymorphic_allocator<ListItem<int>>>;
+
+    ListType lists[3] = {ListType(count, alloc), ListType(count, alloc), ListType(count, alloc)};
+    for (auto _ : state) {
+        ListType first = lists[0].clone();
+        lists[0].clear();
+        lists[0].append(lists[1]);
+        lists[1].clear();
+        lists[1].append(lists[2]);
+        lists[2].clear();
+        lists[2].append(first);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_RotateListsRebuild)->RangeMultiplier(10)->Range(10, 100000);
+
+// ============ Адаптивное представление ============
+// Очередь и обход: кольцо AdaptiveList против узлов LinkedList
+template <typename ListType>
+static void BM_AdaptiveQueueChurn(benchmark::State& state) {
+    size_t count = static_cast<size_t>(state.range(0));
+    ListType list;
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < count; ++i) {
+            list.pushBack(static_cast<int>(i));
+        }
+        while (!list.isEmpty()) {
+            benchmark::DoNotOptimize(list.popFront());
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK_TEMPLATE(BM_AdaptiveQueueChurn, LinkedList<int, std::allocator<ListItem<int>>>)->RangeMultiplier(10)->Range(10, 100000);
+BENCHMARK_TEMPLATE(BM_AdaptiveQueueChurn, AdaptiveList<int, std::allocator<ListItem<int>>>)->RangeMultiplier(10)->Range(10, 100000);
+
+template <typename ListType>
+static void BM_AdaptiveTraverse(benchmark::State& state) {
+    size_t count = static_cast<size_t>(state.range(0));
+    ListType list;
+    for (size_t i = 0; i < count; ++i) {
+        list.pushBack(static_cast<int>(i));
+    }
+
+    for (auto _ : state) {
+        long long sum = 0;
+        list.forEach([&sum](int value) { sum += value; });
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK_TEMPLATE(BM_AdaptiveTraverse, LinkedList<int, std::allocator<ListItem<int>>>)->RangeMultiplier(10)->Range(10, 100000);
+BENCHMARK_TEMPLATE(BM_AdaptiveTraverse, AdaptiveList<int, std::allocator<ListItem<int>>>)->RangeMultiplier(10)->Range(10, 100000);
+
+// ============ Горячие и холодные поля ============
+// Поиск по году: полные узлы ListItem<Book> против узлов с одними горячими полями
+template <>
+struct HotColdLayout<Book> {
+    static constexpr auto hot = std::make_tuple(&Book::year);
+};
+
+static void BM_ScanBookYearLinkedList(benchmark::State& state) {
+    size_t count = static_cast<size_t>(state.range(0));
+    LinkedList<Book, std::allocator<ListItem<Book>>, SlabAllocation> list;
+    for (size_t i = 0; i < count; ++i) {
+        list.pushBack(makeValue<Book>(i));
+    }
+
+    for (auto _ : state) {
+        size_t matched = 0;
+        list.forEach([&matched](const Book& book) { matched += book.year > 2000; });
+        benchmark::DoNotOptimize(matched);
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_ScanBookYearLinkedList)->RangeMultiplier(10)->Range(10, 100000);
+
+static void BM_ScanBookYearHotCold(benchmark::State& state) {
+    size_t count = static_cast<size_t>(state.range(0));
+    HotColdList<Book> list;
+    for (size_t i = 0; i < count; ++i) {
+        list.pushBack(makeValue<Book>(i));
+    }
+
+    for (auto _ : state) {
+        size_t matched = 0;
+        list.forEachHot<&Book::year>([&matched](int year) { matched += year > 2000; });
+        benchmark::DoNotOptimize(matched);
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_ScanBookYearHotCold)->RangeMultiplier(10)->Range(10, 100000);
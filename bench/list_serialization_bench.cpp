@@ -0,0 +1,66 @@
+#include <benchmark/benchmark.h>
+#include "../include/LinkedList.hpp"
+#include "../include/ListSerialization.hpp"
+
+#include <memory_resource>
+#include <sstream>
+#include <string>
+
+// Пропускная способность сохранения и загрузки списка в памяти (без диска)
+
+using IntAllocator = std::pmr::polymorphic_allocator<ListItem<int>>;
+using IntList = LinkedList<int, IntAllocator, SlabAllocation>;
+
+static void BM_SaveInts(benchmark::State& state) {
+    std::pmr::unsynchronized_pool_resource resource;
+    IntList list(static_cast<size_t>(state.range(0)), IntAllocator(&resource));
+
+    std::string buffer;
+    for (auto _ : state) {
+        std::ostringstream out(std::move(buffer), std::ios::binary);
+        saveList(list, out);
+        buffer = std::move(out).str();
+        benchmark::DoNotOptimize(buffer.data());
+        buffer.clear();
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(int));
+}
+BENCHMARK(BM_SaveInts)->Arg(1 << 22)->Unit(benchmark::kMillisecond);
+
+static void BM_LoadInts(benchmark::State& state) {
+    std::pmr::unsynchronized_pool_resource resource;
+    IntList source(static_cast<size_t>(state.range(0)), IntAllocator(&resource));
+
+    std::ostringstream out(std::ios::binary);
+    saveList(source, out);
+    std::string data = std::move(out).str();
+
+    for (auto _ : state) {
+        std::istringstream in(data, std::ios::binary);
+        IntList restored = loadList<IntList>(in, IntAllocator(&resource));
+        benchmark::DoNotOptimize(restored.getSize());
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(int));
+}
+BENCHMARK(BM_LoadInts)->Arg(1 << 22)->Unit(benchmark::kMillisecond);
+
+static void BM_SaveStrings(benchmark::State& state) {
+    using StringAllocator = std::pmr::polymorphic_allocator<ListItem<std::string>>;
+    std::pmr::unsynchronized_pool_resource resource;
+    LinkedList<std::string, StringAllocator, SlabAllocation> list(static_cast<size_t>(state.range(0)), StringAllocator(&resource));
+
+    for (auto it = list.begin(); it != list.end(); ++it) {
+        *it = "serialized string value";
+    }
+
+    for (auto _ : state) {
+        std::ostringstream out(std::ios::binary);
+        saveList(list, out);
+        benchmark::DoNotOptimize(out.tellp());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SaveStrings)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
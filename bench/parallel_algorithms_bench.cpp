@@ -0,0 +1,98 @@
+#include <benchmark/benchmark.h>
+#include "../include/LinkedList.hpp"
+#include "../include/ParallelAlgorithms.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <memory_resource>
+#include <numeric>
+#include <random>
+#include <vector>
+
+// Масштабирование parallelReduce по числу потоков на CPU-нагруженной
+// обработке элементов. Узлы перемешаны в памяти, как после долгой работы списка
+
+struct Point3D {
+    double x, y, z;
+
+    double distance() const {
+        return std::sqrt(x * x + y * y + z * z);
+    }
+};
+
+using PointAllocator = std::pmr::polymorphic_allocator<ListItem<Point3D>>;
+using PointList = LinkedList<Point3D, PointAllocator>;
+
+// Список, узлы которого разбросаны по памяти
+static void buildScattered(PointList& list, std::pmr::memory_resource& resource, size_t count) {
+    std::vector<size_t> order(count);
+    std::iota(order.begin(), order.end(), 0);
+    std::shuffle(order.begin(), order.end(), std::mt19937(7));
+
+    PointList scratch{PointAllocator(&resource)};
+    for (size_t i = 0; i < count; ++i) {
+        Point3D point{double(i), double(i % 7), double(i % 13)};
+        scratch.pushBack(point);
+    }
+
+    // Переставляем узлы перевязкой, а не копированием
+    scratch.sort([&order](const Point3D& a, const Point3D& b) {
+        return order[size_t(a.x)] < order[size_t(b.x)];
+    });
+    list.spliceAfter(list.beforeBegin(), scratch);
+}
+
+// Искусственно утяжелённая обработка элемента
+static double heavyDistance(const Point3D& point) {
+    double result = point.distance();
+    for (int i = 0; i < 64; ++i) {
+        result = std::sqrt(result * result + 1.0);
+    }
+    return result;
+}
+
+static void BM_ParallelReduceDistance(benchmark::State& state) {
+    std::pmr::unsynchronized_pool_resource resource;
+    PointList list{PointAllocator(&resource)};
+    buildScattered(list, resource, 1000000);
+
+    ThreadPool pool(static_cast<size_t>(state.range(0)));
+    auto segments = makeSegments(list, defaultSegmentCount(pool));
+
+    for (auto _ : state) {
+        double total = parallelReduce(segments, 0.0, std::plus<double>(), heavyDistance, pool);
+        benchmark::DoNotOptimize(total);
+    }
+
+    state.SetItemsProcessed(state.iterations() * list.getSize());
+}
+BENCHMARK(BM_ParallelReduceDistance)->RangeMultiplier(2)->Range(1, 16)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+static void BM_SequentialReduceDistance(benchmark::State& state) {
+    std::pmr::unsynchronized_pool_resource resource;
+    PointList list{PointAllocator(&resource)};
+    buildScattered(list, resource, 1000000);
+
+    for (auto _ : state) {
+        double total = 0.0;
+        for (auto it = list.begin(); it != list.end(); ++it) {
+            total += heavyDistance(*it);
+        }
+        benchmark::DoNotOptimize(total);
+    }
+
+    state.SetItemsProcessed(state.iterations() * list.getSize());
+}
+BENCHMARK(BM_SequentialReduceDistance)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+static void BM_MakeSegments(benchmark::State& state) {
+    std::pmr::unsynchronized_pool_resource resource;
+    PointList list{PointAllocator(&resource)};
+    buildScattered(list, resource, 1000000);
+
+    for (auto _ : state) {
+        auto segments = makeSegments(list, 64);
+        benchmark::DoNotOptimize(segments.data());
+    }
+}
+BENCHMARK(BM_MakeSegments)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,171 @@
+#include <benchmark/benchmark.h>
+#include "../include/LinkedList.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <new>
+#include <numeric>
+#include <random>
+#include <vector>
+
+// Обход списка, узлы которого разбросаны по арене больше кэша последнего
+// уровня: с предвыборкой через бегунок (аргумент - дальность, 0 - без неё)
+// и по таблице переходов (аргумент - число одновременно проходимых участков)
+
+struct WideRecord {
+    uint64_t id;
+    double fields[29];
+};
+
+// Ресурс, раздающий блоки одной арены в случайном порядке:
+// соседние узлы списка оказываются в произвольных местах арены
+class ShuffledArenaResource : public std::pmr::memory_resource {
+private:
+    std::vector<std::byte> _arena;
+    std::vector<size_t> _order;
+    size_t _blockSize;
+    size_t _nextBlock;
+
+public:
+    ShuffledArenaResource(size_t blockSize, size_t blockCount) :
+        _arena(blockSize * blockCount), _order(blockCount), _blockSize(blockSize), _nextBlock(0) {
+        std::iota(this->_order.begin(), this->_order.end(), 0);
+        std::shuffle(this->_order.begin(), this->_order.end(), std::mt19937(7));
+    }
+
+protected:
+    void* do_allocate(size_t bytes, size_t) override {
+        if (bytes > this->_blockSize || this->_nextBlock == this->_order.size()) {
+            throw std::bad_alloc();
+        }
+
+        return this->_arena.data() + this->_order[this->_nextBlock++] * this->_blockSize;
+    }
+
+    void do_deallocate(void*, size_t, size_t) override {}
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+};
+
+template <typename T>
+using ScatteredList = LinkedList<T, std::pmr::polymorphic_allocator<ListItem<T>>>;
+
+// 16M узлов по 16 байт - 256 МБ
+static constexpr size_t INT_COUNT = size_t(1) << 24;
+
+// 1M узлов по 248 байт (4 строки кэша)
+static constexpr size_t RECORD_COUNT = size_t(1) << 20;
+
+static void BM_TraverseInts(benchmark::State& state) {
+    ShuffledArenaResource resource(sizeof(ListItem<uint32_t>), INT_COUNT);
+    ScatteredList<uint32_t> list{&resource};
+    for (uint32_t i = 0; i < INT_COUNT; ++i) {
+        list.pushBack(i);
+    }
+
+    size_t distance = static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        uint64_t total = 0;
+        list.forEach([&total](uint32_t value) { total += value; }, distance);
+        benchmark::DoNotOptimize(total);
+    }
+
+    state.SetItemsProcessed(state.iterations() * list.getSize());
+}
+BENCHMARK(BM_TraverseInts)->Arg(0)->Arg(4)->Arg(16)->Arg(64)->Unit(benchmark::kMillisecond);
+
+static void BM_TraverseWideRecords(benchmark::State& state) {
+    ShuffledArenaResource resource(sizeof(ListItem<WideRecord>), RECORD_COUNT);
+    ScatteredList<WideRecord> list{&resource};
+
+    WideRecord record{};
+    std::fill(std::begin(record.fields), std::end(record.fields), 1.0);
+    for (size_t i = 0; i < RECORD_COUNT; ++i) {
+        record.id = i;
+        list.pushBack(record);
+    }
+
+    size_t distance = static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        double total = 0.0;
+        list.forEach([&total](const WideRecord& record) {
+            total += record.fields[0] + record.fields[28];
+        }, distance);
+        benchmark::DoNotOptimize(total);
+    }
+
+    state.SetItemsProcessed(state.iterations() * list.getSize());
+}
+BENCHMARK(BM_TraverseWideRecords)->Arg(0)->Arg(4)->Arg(16)->Arg(64)->Unit(benchmark::kMillisecond);
+
+static void BM_PrefetchIterator(benchmark::State& state) {
+    ShuffledArenaResource resource(sizeof(ListItem<WideRecord>), RECORD_COUNT);
+    ScatteredList<WideRecord> list{&resource};
+
+    WideRecord record{};
+    for (size_t i = 0; i < RECORD_COUNT; ++i) {
+        record.id = i;
+        list.pushBack(record);
+    }
+
+    size_t distance = static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        uint64_t total = 0;
+        for (auto it = list.prefetchBegin(distance); it != list.prefetchEnd(); ++it) {
+            total += (*it).id;
+        }
+        benchmark::DoNotOptimize(total);
+    }
+
+    state.SetItemsProcessed(state.iterations() * list.getSize());
+}
+BENCHMARK(BM_PrefetchIterator)->Arg(0)->Arg(16)->Unit(benchmark::kMillisecond);
+
+// Одновременный обход участков по таблице переходов
+static void BM_TraverseIntsJumpTable(benchmark::State& state) {
+    ShuffledArenaResource resource(sizeof(ListItem<uint32_t>), INT_COUNT);
+    ScatteredList<uint32_t> list{&resource};
+    for (uint32_t i = 0; i < INT_COUNT; ++i) {
+        list.pushBack(i);
+    }
+
+    auto table = list.makeJumpTable(64);
+    size_t lanes = static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        uint64_t total = 0;
+        list.forEach([&total](uint32_t value) { total += value; }, table, lanes);
+        benchmark::DoNotOptimize(total);
+    }
+
+    state.SetItemsProcessed(state.iterations() * list.getSize());
+}
+BENCHMARK(BM_TraverseIntsJumpTable)->Arg(1)->Arg(4)->Arg(8)->Arg(16)->Unit(benchmark::kMillisecond);
+
+static void BM_TraverseWideRecordsJumpTable(benchmark::State& state) {
+    ShuffledArenaResource resource(sizeof(ListItem<WideRecord>), RECORD_COUNT);
+    ScatteredList<WideRecord> list{&resource};
+
+    WideRecord record{};
+    std::fill(std::begin(record.fields), std::end(record.fields), 1.0);
+    for (size_t i = 0; i < RECORD_COUNT; ++i) {
+        record.id = i;
+        list.pushBack(record);
+    }
+
+    auto table = list.makeJumpTable(64);
+    size_t lanes = static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        double total = 0.0;
+        list.forEach([&total](const WideRecord& record) {
+            total += record.fields[0] + record.fields[28];
+        }, table, lanes);
+        benchmark::DoNotOptimize(total);
+    }
+
+    state.SetItemsProcessed(state.iterations() * list.getSize());
+}
+BENCHMARK(BM_TraverseWideRecordsJumpTable)->Arg(1)->Arg(8)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,764 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "LinkedList.hpp"
+
+// Итератор AdaptiveList. Хранит позицию элемента, а в связном представлении -
+// ещё и итератор LinkedList. Смена представления делает итераторы,
+// полученные до неё, недействительными (кроме позиции, переданной в ту
+// операцию, которая смену вызвала)
+template <typename Type, bool IsConst = false>
+class AdaptiveListIterator {
+private:
+    friend Type;
+    friend class AdaptiveListIterator<Type, !IsConst>;
+
+    using ListPointer = std::conditional_t<IsConst, const Type*, Type*>;
+    using LinkedIterator = std::conditional_t<
+        IsConst, typename Type::linkedType::const_iterator, typename Type::linkedType::iterator
+    >;
+
+    // Индекс итератора, стоящего перед первым элементом (beforeBegin)
+    static constexpr size_t BEFORE_BEGIN_IDX = static_cast<size_t>(-1);
+
+    ListPointer _pointer;
+    size_t _currIdx;
+    LinkedIterator _linked;
+    bool _isLinked;
+
+public:
+    using value_type = typename Type::elementType;
+    using reference = std::conditional_t<IsConst, const value_type&, value_type&>;
+    using pointer   = std::conditional_t<IsConst, const value_type*, value_type*>;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category = std::forward_iterator_tag;
+
+    AdaptiveListIterator() : _pointer(nullptr), _currIdx(0), _linked(), _isLinked(false) {}
+
+    AdaptiveListIterator(ListPointer listPtr, size_t elemIdx) :
+        _pointer(listPtr), _currIdx(elemIdx), _linked(), _isLinked(false) {}
+
+    AdaptiveListIterator(ListPointer listPtr, size_t elemIdx, LinkedIterator linked) :
+        _pointer(listPtr), _currIdx(elemIdx), _linked(linked), _isLinked(true) {}
+
+    // Неконстантный итератор приводится к константному
+    template <bool OtherConst>
+    requires (IsConst && !OtherConst)
+    AdaptiveListIterator(const AdaptiveListIterator<Type, OtherConst>& other) :
+        _pointer(other._pointer), _currIdx(other._currIdx), _linked(other._linked), _isLinked(other._isLinked) {}
+
+    reference operator*() const {
+        if (this->_isLinked) {
+            return *this->_linked;
+        }
+
+        if (this->_currIdx >= this->_pointer->_ringSize) {
+            throw std::out_of_range("List index is out of range!");
+        }
+
+        return this->_pointer->ringAt(this->_currIdx);
+    }
+
+    pointer operator->() const {
+        return &**this;
+    }
+
+    AdaptiveListIterator& operator++() {
+        if (this->_isLinked) {
+            ++this->_linked;
+        }
+
+        ++this->_currIdx;
+        return *this;
+    }
+
+    AdaptiveListIterator operator++(int) {
+        AdaptiveListIterator temp(*this);
+        ++(*this);
+        return temp;
+    }
+
+    // В связном представлении индекс устаревает после вставок в середину,
+    // позиции сравниваются по узлу
+    bool operator==(const AdaptiveListIterator& other) const {
+        if (this->_isLinked && other._isLinked) {
+            return this->_pointer == other._pointer && this->_linked == other._linked;
+        }
+
+        return this->_currIdx == other._currIdx && this->_pointer == other._pointer;
+    }
+
+    bool operator!=(const AdaptiveListIterator& other) const {
+        return !(*this == other);
+    }
+
+    bool operator==(std::default_sentinel_t) const {
+        if (this->_isLinked) {
+            return this->_linked == std::default_sentinel;
+        }
+
+        return this->_currIdx != BEFORE_BEGIN_IDX && this->_currIdx >= this->_pointer->_ringSize;
+    }
+};
+
+// Список с интерфейсом LinkedList, сам выбирающий представление.
+// Пока операции идут только на концах, элементы лежат подряд в кольцевом
+// буфере (ёмкость растёт вдвое): push/pop - O(1) без выделения на каждый
+// элемент, обход и operator[] идут по непрерывной памяти.
+// Вставка и удаление в середине и перенос узлов переводят список в
+// LinkedList. Обратно в кольцо он возвращается, когда опустеет или когда
+// после последней такой операции пройдёт не меньше max(MIN_COMPACT_OPS, size)
+// операций на концах - стоимость перевода окупается ими.
+// Отличия от LinkedList: в кольце нет узлов, поэтому operator[] возвращает
+// сам элемент (T&), а не ListItem<T>&; индексы (find, rebuildIndex), swap и
+// перемещающее присваивание не поддерживаются
+template <typename T, typename AllocatorType>
+requires std::is_default_constructible_v<T> && NodeAllocator<AllocatorType, ListItem<T>>
+class AdaptiveList {
+private:
+    using ListType = AdaptiveList<T, AllocatorType>;
+    using ValueAllocatorType = typename std::allocator_traits<AllocatorType>::template rebind_alloc<T>;
+    using ValueAllocatorTraits = std::allocator_traits<ValueAllocatorType>;
+
+    friend class AdaptiveListIterator<ListType>;
+    friend class AdaptiveListIterator<ListType, true>;
+
+    static constexpr size_t MIN_RING_CAPACITY = 8;
+
+public:
+    using linkedType = LinkedList<T, AllocatorType>;
+
+private:
+    ValueAllocatorType _allocator;
+
+    // Кольцевой буфер: элемент i лежит в _ring[(_frontPos + i) & (_capacity - 1)]
+    T* _ring;
+    size_t _capacity;
+    size_t _frontPos;
+    size_t _ringSize;
+
+    linkedType _linked;
+    bool _isLinked;
+
+    // Операции на концах с момента последней операции, потребовавшей связи
+    size_t _endOpsSinceLink;
+
+    T& ringAt(size_t idx) const {
+        return this->_ring[(this->_frontPos + idx) & (this->_capacity - 1)];
+    }
+
+    void destroyRingItems() {
+        for (size_t i = 0; i < this->_ringSize; ++i) {
+            ValueAllocatorTraits::destroy(this->_allocator, &this->ringAt(i));
+        }
+        this->_ringSize = 0;
+        this->_frontPos = 0;
+    }
+
+    void releaseRing() {
+        this->destroyRingItems();
+
+        if (this->_ring != nullptr) {
+            ValueAllocatorTraits::deallocate(this->_allocator, this->_ring, this->_capacity);
+        }
+
+        this->_ring = nullptr;
+        this->_capacity = 0;
+    }
+
+    // Перенос элементов в новый буфер, элемент 0 - в начало буфера
+    void growRing(size_t newCapacity) {
+        T* newRing = ValueAllocatorTraits::allocate(this->_allocator, newCapacity);
+
+        size_t moved = 0;
+        try {
+            for (; moved < this->_ringSize; ++moved) {
+                ValueAllocatorTraits::construct(this->_allocator, newRing + moved, std::move_if_noexcept(this->ringAt(moved)));
+            }
+        } catch (...) {
+            for (size_t i = 0; i < moved; ++i) {
+                ValueAllocatorTraits::destroy(this->_allocator, newRing + i);
+            }
+            ValueAllocatorTraits::deallocate(this->_allocator, newRing, newCapacity);
+            throw;
+        }
+
+        size_t ringSize = this->_ringSize;
+        this->releaseRing();
+
+        this->_ring = newRing;
+        this->_capacity = newCapacity;
+        this->_ringSize = ringSize;
+    }
+
+    void ensureRingSpace() {
+        if (this->_ringSize == this->_capacity) {
+            this->growRing(std::max(MIN_RING_CAPACITY, this->_capacity * 2));
+        }
+    }
+
+    template <typename... Args>
+    T& ringEmplaceBack(Args&&... args) {
+        this->ensureRingSpace();
+
+        T* slot = &this->ringAt(this->_ringSize);
+        ValueAllocatorTraits::construct(this->_allocator, slot, std::forward<Args>(args)...);
+        ++this->_ringSize;
+
+        return *slot;
+    }
+
+    template <typename... Args>
+    T& ringEmplaceFront(Args&&... args) {
+        this->ensureRingSpace();
+
+        size_t newFront = (this->_frontPos - 1) & (this->_capacity - 1);
+        ValueAllocatorTraits::construct(this->_allocator, this->_ring + newFront, std::forward<Args>(args)...);
+        this->_frontPos = newFront;
+        ++this->_ringSize;
+
+        return this->_ring[newFront];
+    }
+
+    // Перевод в связное представление. Все узлы выделяются до переноса
+    // значений; при ошибке кольцо остаётся нетронутым
+    void toLinked() {
+        this->_endOpsSinceLink = 0;
+        if (this->_isLinked) {
+            return;
+        }
+
+        linkedType linked(this->_ringSize, AllocatorType(this->_allocator));
+
+        size_t idx = 0;
+        for (T& value : linked) {
+            if constexpr (std::is_nothrow_move_assignable_v<T>) {
+                value = std::move(this->ringAt(idx++));
+            } else {
+                value = this->ringAt(idx++);
+            }
+        }
+
+        this->releaseRing();
+        this->_linked = std::move(linked);
+        this->_isLinked = true;
+    }
+
+    // Возврат к кольцевому буферу. Буфер выделяется целиком до переноса;
+    // при ошибке связный список остаётся нетронутым
+    void toRing() {
+        size_t size = this->_linked.getSize();
+
+        if (size > 0) {
+            size_t capacity = std::bit_ceil(std::max(MIN_RING_CAPACITY, size));
+            T* ring = ValueAllocatorTraits::allocate(this->_allocator, capacity);
+
+            size_t constructed = 0;
+            try {
+                for (T& value : this->_linked) {
+                    ValueAllocatorTraits::construct(this->_allocator, ring + constructed, std::move_if_noexcept(value));
+                    ++constructed;
+                }
+            } catch (...) {
+                for (size_t i = 0; i < constructed; ++i) {
+                    ValueAllocatorTraits::destroy(this->_allocator, ring + i);
+                }
+                ValueAllocatorTraits::deallocate(this->_allocator, ring, capacity);
+                throw;
+            }
+
+            this->_ring = ring;
+            this->_capacity = capacity;
+            this->_frontPos = 0;
+            this->_ringSize = size;
+        }
+
+        this->_linked.clear();
+        this->_isLinked = false;
+    }
+
+    // Учёт операции на конце в связном представлении
+    void noteEndOp() {
+        if (!this->_isLinked) {
+            return;
+        }
+
+        ++this->_endOpsSinceLink;
+        if (this->_linked.isEmpty() || this->_endOpsSinceLink >= std::max(MIN_COMPACT_OPS, this->_linked.getSize())) {
+            // Сжатие - только оптимизация: операция на конце уже выполнена,
+            // и при нехватке памяти список просто остаётся связным
+            try {
+                this->toRing();
+            } catch (...) {
+                this->_endOpsSinceLink = 0;
+            }
+        }
+    }
+
+    // Уплотнение кольца с сохранением порядка: элемент idx удаляется, если
+    // removeAt(idx, kept) истинно; kept - число уже оставленных элементов,
+    // последний из них лежит в ringAt(kept - 1). Возвращает число удалённых.
+    // Если removeAt бросает исключение, непросмотренный хвост сохраняется
+    template <typename RemovePredicate>
+    size_t compactRing(RemovePredicate removeAt) {
+        size_t kept = 0;
+        size_t idx = 0;
+
+        // Непросмотренный хвост сдвигается к kept, освободившиеся ячейки разрушаются
+        auto closeGap = [this, &kept, &idx]() {
+            for (; idx < this->_ringSize; ++idx, ++kept) {
+                if (kept != idx) {
+                    this->ringAt(kept) = std::move(this->ringAt(idx));
+                }
+            }
+
+            size_t removed = this->_ringSize - kept;
+            for (size_t slot = kept; slot < this->_ringSize; ++slot) {
+                ValueAllocatorTraits::destroy(this->_allocator, &this->ringAt(slot));
+            }
+            this->_ringSize = kept;
+
+            return removed;
+        };
+
+        try {
+            for (; idx < this->_ringSize; ++idx) {
+                if (removeAt(idx, kept)) {
+                    continue;
+                }
+
+                if (kept != idx) {
+                    this->ringAt(kept) = std::move(this->ringAt(idx));
+                }
+                ++kept;
+            }
+        } catch (...) {
+            closeGap();
+            throw;
+        }
+
+        return closeGap();
+    }
+
+    // Итератор LinkedList для позиции pos (список уже связный)
+    typename linkedType::iterator linkedPosition(const AdaptiveListIterator<ListType>& pos) {
+        if (pos._pointer != this) {
+            throw std::logic_error("Iterator does not belong to this list!");
+        }
+
+        if (pos._isLinked) {
+            return pos._linked;
+        }
+
+        return std::ranges::next(this->_linked.beforeBegin(), pos._currIdx + 1, this->_linked.end());
+    }
+
+public:
+    using elementType = T;
+    using iterator = AdaptiveListIterator<ListType>;
+    using const_iterator = AdaptiveListIterator<ListType, true>;
+    using sentinel = std::default_sentinel_t;
+
+    // Минимум операций на концах, после которого связный список сжимается в кольцо
+    static constexpr size_t MIN_COMPACT_OPS = 64;
+
+    AdaptiveList(AllocatorType alloc = {}) :
+        _allocator(alloc), _ring(nullptr), _capacity(0), _frontPos(0), _ringSize(0),
+        _linked(alloc), _isLinked(false), _endOpsSinceLink(0) {}
+
+    AdaptiveList(std::initializer_list<T> params, AllocatorType alloc = {}) : AdaptiveList(alloc) {
+        if (params.size() > 0) {
+            this->growRing(std::bit_ceil(std::max(MIN_RING_CAPACITY, params.size())));
+        }
+
+        for (const T& value : params) {
+            this->ringEmplaceBack(value);
+        }
+    }
+
+    AdaptiveList(const AdaptiveList&) = delete;
+
+    AdaptiveList(AdaptiveList&& other) noexcept :
+        _allocator(other._allocator), _ring(other._ring), _capacity(other._capacity), _frontPos(other._frontPos),
+        _ringSize(other._ringSize), _linked(std::move(other._linked)), _isLinked(other._isLinked),
+        _endOpsSinceLink(other._endOpsSinceLink) {
+        other._ring = nullptr;
+        other._capacity = 0;
+        other._frontPos = 0;
+        other._ringSize = 0;
+        other._isLinked = false;
+        other._endOpsSinceLink = 0;
+    }
+
+    ~AdaptiveList() {
+        this->releaseRing();
+    }
+
+    // Элементы лежат подряд в кольцевом буфере
+    bool isContiguous() const {
+        return !this->_isLinked;
+    }
+
+    size_t getSize() const {
+        return this->_isLinked ? this->_linked.getSize() : this->_ringSize;
+    }
+
+    // Для std::ranges::size и sized_range
+    size_t size() const {
+        return this->getSize();
+    }
+
+    bool isEmpty() const {
+        return this->getSize() == 0;
+    }
+
+    // Доступ по индексу: O(1) в кольце, O(n) в связном представлении
+    T& operator[](size_t idx) {
+        if (idx >= this->getSize()) {
+            throw std::out_of_range("List index is out of range!");
+        }
+
+        return this->_isLinked ? this->_linked[idx].value : this->ringAt(idx);
+    }
+
+    const T& operator[](size_t idx) const {
+        return const_cast<AdaptiveList&>(*this)[idx];
+    }
+
+    void clear() {
+        this->releaseRing();
+        this->_linked.clear();
+        this->_isLinked = false;
+        this->_endOpsSinceLink = 0;
+    }
+
+    template <typename... Args>
+    T& emplaceFront(Args&&... args) {
+        if (!this->_isLinked) {
+            return this->ringEmplaceFront(std::forward<Args>(args)...);
+        }
+
+        T& value = this->_linked.emplaceFront(std::forward<Args>(args)...);
+        this->noteEndOp();
+
+        // Ссылка на элемент после возможного сжатия в кольцо
+        return this->_isLinked ? value : this->ringAt(0);
+    }
+
+    template <typename... Args>
+    T& emplaceBack(Args&&... args) {
+        if (!this->_isLinked) {
+            return this->ringEmplaceBack(std::forward<Args>(args)...);
+        }
+
+        T& value = this->_linked.emplaceBack(std::forward<Args>(args)...);
+        this->noteEndOp();
+
+        return this->_isLinked ? value : this->ringAt(this->_ringSize - 1);
+    }
+
+    void pushFront(const T& value) {
+        this->emplaceFront(value);
+    }
+
+    void pushFront(T&& value) {
+        this->emplaceFront(std::move(value));
+    }
+
+    void pushBack(const T& value) {
+        this->emplaceBack(value);
+    }
+
+    void pushBack(T&& value) {
+        this->emplaceBack(std::move(value));
+    }
+
+    // Добавление диапазона [first, last) в конец списка - операция на конце,
+    // представление не меняется. Для forward-итераторов кольцо расширяется один раз
+    template <std::input_iterator InputIt, std::sentinel_for<InputIt> Sentinel>
+    void append(InputIt first, Sentinel last) {
+        if (this->_isLinked) {
+            this->_linked.append(std::move(first), last);
+            this->noteEndOp();
+            return;
+        }
+
+        if constexpr (std::forward_iterator<InputIt>) {
+            size_t needed = this->_ringSize + static_cast<size_t>(std::ranges::distance(first, last));
+            if (needed > this->_capacity) {
+                this->growRing(std::bit_ceil(std::max(MIN_RING_CAPACITY, needed)));
+            }
+        }
+
+        for (; first != last; ++first) {
+            this->ringEmplaceBack(*first);
+        }
+    }
+
+    template <std::ranges::input_range Range>
+    void append(Range&& range) {
+        this->append(std::ranges::begin(range), std::ranges::end(range));
+    }
+
+    T popFront() {
+        if (this->_isLinked) {
+            T value = this->_linked.popFront();
+            this->noteEndOp();
+            return value;
+        }
+
+        if (this->_ringSize == 0) {
+            throw std::out_of_range("Cannot pop from empty list!");
+        }
+
+        T& front = this->ringAt(0);
+        T value = std::move(front);
+        ValueAllocatorTraits::destroy(this->_allocator, &front);
+
+        this->_frontPos = (this->_frontPos + 1) & (this->_capacity - 1);
+        --this->_ringSize;
+
+        return value;
+    }
+
+    // O(1) в кольце, O(n) в связном представлении
+    T popBack() {
+        if (this->_isLinked) {
+            T value = this->_linked.popBack();
+            this->noteEndOp();
+            return value;
+        }
+
+        if (this->_ringSize == 0) {
+            throw std::out_of_range("Cannot pop from empty list!");
+        }
+
+        T& back = this->ringAt(this->_ringSize - 1);
+        T value = std::move(back);
+        ValueAllocatorTraits::destroy(this->_allocator, &back);
+        --this->_ringSize;
+
+        return value;
+    }
+
+    // Вставка value после позиции pos, возвращает итератор на новый элемент.
+    // Переводит список в связное представление
+    iterator insertAfter(iterator pos, const T& value) {
+        this->toLinked();
+
+        auto linkedIt = this->_linked.insertAfter(this->linkedPosition(pos), value);
+        return iterator(this, pos._currIdx + 1, linkedIt);
+    }
+
+    // Удаление элемента, следующего за pos, возвращает итератор на элемент после удалённого.
+    // Переводит список в связное представление
+    iterator eraseAfter(iterator pos) {
+        this->toLinked();
+
+        auto linkedIt = this->_linked.eraseAfter(this->linkedPosition(pos));
+        return iterator(this, pos._currIdx + 1, linkedIt);
+    }
+
+    // Перенос всех элементов other после позиции pos.
+    // Оба списка переводятся в связное представление, other остаётся пустым
+    void spliceAfter(iterator pos, AdaptiveList& other) {
+        if (&other == this) {
+            return;
+        }
+
+        this->toLinked();
+        other.toLinked();
+
+        this->_linked.spliceAfter(this->linkedPosition(pos), other._linked);
+        other.toRing();
+    }
+
+    // Перенос элементов other из интервала (first, last) после позиции pos.
+    // Оба списка переводятся в связное представление; other возвращается
+    // в кольцо, если опустел
+    void spliceAfter(iterator pos, AdaptiveList& other, iterator first, iterator last) {
+        this->toLinked();
+        other.toLinked();
+
+        this->_linked.spliceAfter(
+            this->linkedPosition(pos), other._linked, other.linkedPosition(first), other.linkedPosition(last)
+        );
+        if (other._linked.isEmpty()) {
+            other.toRing();
+        }
+    }
+
+    // Перенос элементов other после first до конца other
+    void spliceAfter(iterator pos, AdaptiveList& other, iterator first, sentinel) {
+        this->toLinked();
+        other.toLinked();
+
+        this->_linked.spliceAfter(this->linkedPosition(pos), other._linked, other.linkedPosition(first), std::default_sentinel);
+        if (other._linked.isEmpty()) {
+            other.toRing();
+        }
+    }
+
+    // Удаление всех элементов, для которых pred(value) истинно, с сохранением
+    // порядка; представление не меняется. Возвращает число удалённых.
+    // Если pred бросает исключение, удалены только уже отобранные элементы,
+    // остальные сохраняют порядок
+    template <typename UnaryPredicate>
+    size_t removeIf(UnaryPredicate pred) {
+        if (this->_isLinked) {
+            return this->_linked.removeIf(pred);
+        }
+
+        return this->compactRing([this, &pred](size_t idx, size_t) { return pred(this->ringAt(idx)); });
+    }
+
+    // Удаление всех элементов, равных value, возвращает число удалённых
+    size_t erase(const T& value) {
+        return this->removeIf([&value](const T& item) { return item == value; });
+    }
+
+    // Копия списка у alloc; копия всегда лежит в кольце
+    AdaptiveList clone(AllocatorType alloc) const {
+        AdaptiveList copy(alloc);
+
+        size_t size = this->getSize();
+        if (size > 0) {
+            copy.growRing(std::bit_ceil(std::max(MIN_RING_CAPACITY, size)));
+        }
+
+        for (const T& value : *this) {
+            copy.ringEmplaceBack(value);
+        }
+
+        return copy;
+    }
+
+    AdaptiveList clone() const {
+        return this->clone(AllocatorType(this->_allocator));
+    }
+
+    // Устойчивая сортировка. В кольце - std::stable_sort по непрерывной памяти
+    // (кольцо, перешедшее через конец буфера, сначала выпрямляется)
+    template <typename Compare = std::less<T>>
+    void sort(Compare comp = {}) {
+        if (this->_isLinked) {
+            this->_linked.sort(comp);
+            return;
+        }
+
+        if (this->_ringSize < 2) {
+            return;
+        }
+
+        if (this->_frontPos + this->_ringSize > this->_capacity) {
+            this->growRing(this->_capacity);
+        }
+
+        T* first = this->_ring + this->_frontPos;
+        std::stable_sort(first, first + this->_ringSize, comp);
+    }
+
+    void reverse() {
+        if (this->_isLinked) {
+            this->_linked.reverse();
+            return;
+        }
+
+        for (size_t i = 0; i < this->_ringSize / 2; ++i) {
+            std::swap(this->ringAt(i), this->ringAt(this->_ringSize - 1 - i));
+        }
+    }
+
+    // Слияние с отсортированным списком other, other становится пустым.
+    // При равенстве элементы this идут раньше элементов other.
+    // Переводит список в связное представление
+    template <typename Compare = std::less<T>>
+    void merge(AdaptiveList& other, Compare comp = {}) {
+        if (&other == this || other.isEmpty()) {
+            return;
+        }
+
+        this->toLinked();
+        other.toLinked();
+
+        this->_linked.merge(other._linked, comp);
+        other.toRing();
+    }
+
+    // Удаление подряд идущих равных элементов, возвращает число удалённых;
+    // представление не меняется
+    template <typename BinaryPredicate = std::equal_to<T>>
+    size_t unique(BinaryPredicate pred = {}) {
+        if (this->_isLinked) {
+            return this->_linked.unique(pred);
+        }
+
+        return this->compactRing([this, &pred](size_t idx, size_t kept) {
+            return kept > 0 && pred(this->ringAt(kept - 1), this->ringAt(idx));
+        });
+    }
+
+    // func(value) для каждого элемента по порядку
+    template <typename Func>
+    void forEach(Func func) {
+        if (this->_isLinked) {
+            this->_linked.forEach(func);
+            return;
+        }
+
+        // Кольцо проходится двумя непрерывными участками
+        size_t firstPart = std::min(this->_ringSize, this->_capacity - this->_frontPos);
+        for (size_t i = 0; i < firstPart; ++i) {
+            func(this->_ring[this->_frontPos + i]);
+        }
+        for (size_t i = 0; i < this->_ringSize - firstPart; ++i) {
+            func(this->_ring[i]);
+        }
+    }
+
+    iterator beforeBegin() {
+        if (this->_isLinked) {
+            return iterator(this, iterator::BEFORE_BEGIN_IDX, this->_linked.beforeBegin());
+        }
+
+        return iterator(this, iterator::BEFORE_BEGIN_IDX);
+    }
+
+    iterator begin() {
+        if (this->_isLinked) {
+            return iterator(this, 0, this->_linked.begin());
+        }
+
+        return iterator(this, 0);
+    }
+
+    const_iterator begin() const {
+        if (this->_isLinked) {
+            return const_iterator(this, 0, this->_linked.begin());
+        }
+
+        return const_iterator(this, 0);
+    }
+
+    const_iterator cbegin() const {
+        return this->begin();
+    }
+
+    sentinel end() const {
+        return std::default_sentinel;
+    }
+
+    sentinel cend() const {
+        return std::default_sentinel;
+    }
+};
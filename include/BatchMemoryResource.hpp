@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+
+// memory_resource, умеющий освобождать много блоков одного размера за один
+// вызов. Списки возвращают через него память удалённых узлов пакетами.
+// По умолчанию блоки освобождаются по одному
+class BatchMemoryResource : public std::pmr::memory_resource {
+public:
+    // Порядок адресов в ptrs может быть изменён
+    void deallocateBatch(void** ptrs, size_t count, size_t bytes, size_t alignment) {
+        this->do_deallocate_batch(ptrs, count, bytes, alignment);
+    }
+
+protected:
+    virtual void do_deallocate_batch(void** ptrs, size_t count, size_t bytes, size_t alignment) {
+        for (size_t i = 0; i < count; ++i) {
+            this->deallocate(ptrs[i], bytes, alignment);
+        }
+    }
+};
@@ -0,0 +1,384 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <deque>
+#include <initializer_list>
+#include <memory>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "FieldIndex.hpp"
+
+// Описание полей структуры для ColumnarList. Специализируется пользователем:
+//
+//   template <>
+//   struct ColumnarLayout<Point3D> {
+//       static constexpr auto fields = std::make_tuple(&Point3D::x, &Point3D::y, &Point3D::z);
+//   };
+template <typename T>
+struct ColumnarLayout;
+
+template <typename T>
+concept ColumnarType = std::is_default_constructible_v<T> && requires {
+    std::tuple_size<std::remove_cvref_t<decltype(ColumnarLayout<T>::fields)>>::value;
+};
+
+// Последовательность структур, хранящая каждое поле в отдельном столбце
+// (structure-of-arrays). Столбцы разбиты на куски по CHUNK_SIZE элементов,
+// поэтому pushFront/pushBack/popFront/popBack работают за O(1), как у списка,
+// а внутри куска значения поля лежат подряд, и циклы по ним векторизуются.
+// Элементы как объекты T не хранятся: operator[] и pop собирают T из столбцов
+template <ColumnarType T, typename AllocatorType = std::allocator<T>>
+class ColumnarList {
+private:
+    using Fields = std::remove_cvref_t<decltype(ColumnarLayout<T>::fields)>;
+
+    static constexpr size_t FIELD_COUNT = std::tuple_size_v<Fields>;
+
+    template <size_t I>
+    using FieldType = std::remove_cvref_t<decltype(std::declval<T&>().*std::get<I>(ColumnarLayout<T>::fields))>;
+
+    template <size_t I>
+    using FieldAllocatorType = typename std::allocator_traits<AllocatorType>::template rebind_alloc<FieldType<I>>;
+
+    template <size_t... I>
+    static auto makeColumns(std::index_sequence<I...>) -> std::tuple<FieldType<I>*...>;
+
+    using Columns = decltype(makeColumns(std::make_index_sequence<FIELD_COUNT>{}));
+
+    std::deque<Columns> _chunks;
+    size_t _frontOffset;
+    size_t _listSize;
+    AllocatorType _allocator;
+
+    template <size_t I>
+    void destroyColumn(FieldType<I>* column, size_t constructed) {
+        FieldAllocatorType<I> fieldAlloc(this->_allocator);
+
+        for (size_t slot = 0; slot < constructed; ++slot) {
+            std::allocator_traits<FieldAllocatorType<I>>::destroy(fieldAlloc, column + slot);
+        }
+        std::allocator_traits<FieldAllocatorType<I>>::deallocate(fieldAlloc, column, CHUNK_SIZE);
+    }
+
+    template <size_t I>
+    FieldType<I>* createColumn() {
+        FieldAllocatorType<I> fieldAlloc(this->_allocator);
+        FieldType<I>* column = std::allocator_traits<FieldAllocatorType<I>>::allocate(fieldAlloc, CHUNK_SIZE);
+
+        size_t constructed = 0;
+        try {
+            for (; constructed < CHUNK_SIZE; ++constructed) {
+                std::allocator_traits<FieldAllocatorType<I>>::construct(fieldAlloc, column + constructed);
+            }
+        } catch (...) {
+            this->destroyColumn<I>(column, constructed);
+            throw;
+        }
+
+        return column;
+    }
+
+    template <size_t... I>
+    Columns createChunk(std::index_sequence<I...>) {
+        Columns chunk{static_cast<FieldType<I>*>(nullptr)...};
+
+        try {
+            ((std::get<I>(chunk) = this->createColumn<I>()), ...);
+        } catch (...) {
+            this->releaseChunk(chunk, std::index_sequence<I...>{});
+            throw;
+        }
+
+        return chunk;
+    }
+
+    template <size_t... I>
+    void releaseChunk(Columns& chunk, std::index_sequence<I...>) {
+        ((std::get<I>(chunk) != nullptr ? this->destroyColumn<I>(std::get<I>(chunk), CHUNK_SIZE) : void()), ...);
+    }
+
+    Columns createChunk() {
+        return this->createChunk(std::make_index_sequence<FIELD_COUNT>{});
+    }
+
+    void releaseChunk(Columns& chunk) {
+        this->releaseChunk(chunk, std::make_index_sequence<FIELD_COUNT>{});
+    }
+
+    template <size_t... I>
+    void storeAt(size_t position, const T& value, std::index_sequence<I...>) {
+        Columns& chunk = this->_chunks[position / CHUNK_SIZE];
+        size_t slot = position % CHUNK_SIZE;
+
+        ((std::get<I>(chunk)[slot] = value.*std::get<I>(ColumnarLayout<T>::fields)), ...);
+    }
+
+    // Сборка элемента; при release поля переносятся, а ячейки сбрасываются
+    template <size_t... I>
+    T loadAt(size_t position, bool release, std::index_sequence<I...>) {
+        Columns& chunk = this->_chunks[position / CHUNK_SIZE];
+        size_t slot = position % CHUNK_SIZE;
+        T value{};
+
+        if (release) {
+            ((value.*std::get<I>(ColumnarLayout<T>::fields) = std::exchange(std::get<I>(chunk)[slot], FieldType<I>{})), ...);
+        } else {
+            ((value.*std::get<I>(ColumnarLayout<T>::fields) = std::get<I>(chunk)[slot]), ...);
+        }
+
+        return value;
+    }
+
+    // Кусок остаётся только один, с местом для вставок с обеих сторон
+    void trimEmpty() {
+        while (this->_chunks.size() > 1) {
+            this->releaseChunk(this->_chunks.back());
+            this->_chunks.pop_back();
+        }
+
+        this->_frontOffset = CHUNK_SIZE / 2;
+    }
+
+    template <size_t... I, typename Func>
+    void forEachRunImpl(std::index_sequence<I...>, Func& func) const {
+        size_t endPosition = this->_frontOffset + this->_listSize;
+
+        for (size_t chunkIdx = 0; chunkIdx * CHUNK_SIZE < endPosition && this->_listSize > 0; ++chunkIdx) {
+            size_t first = chunkIdx == 0 ? this->_frontOffset : 0;
+            size_t last = std::min(CHUNK_SIZE, endPosition - chunkIdx * CHUNK_SIZE);
+            const Columns& chunk = this->_chunks[chunkIdx];
+
+            func(last - first, static_cast<const FieldType<I>*>(std::get<I>(chunk) + first)...);
+        }
+    }
+
+public:
+    static constexpr size_t CHUNK_SIZE = 512;
+
+    using elementType = T;
+
+    // Номер столбца поля по указателю на член
+    template <auto Field>
+    static constexpr size_t columnIndex() {
+        constexpr size_t idx = fieldIndex<Field>(ColumnarLayout<T>::fields);
+        static_assert(idx < FIELD_COUNT, "Field is not listed in ColumnarLayout");
+        return idx;
+    }
+
+    template <auto Field>
+    using ColumnType = FieldType<columnIndex<Field>()>;
+
+    ColumnarList(AllocatorType alloc = {}) : _frontOffset(0), _listSize(0), _allocator(alloc) {}
+
+    ColumnarList(std::initializer_list<T> params, AllocatorType alloc = {}) : ColumnarList(alloc) {
+        for (const T& value : params) {
+            this->pushBack(value);
+        }
+    }
+
+    ColumnarList(const ColumnarList&) = delete;
+
+    ColumnarList(ColumnarList&& other) noexcept :
+        _chunks(std::move(other._chunks)), _frontOffset(other._frontOffset),
+        _listSize(other._listSize), _allocator(other._allocator) {
+        other._chunks.clear();
+        other._frontOffset = 0;
+        other._listSize = 0;
+    }
+
+    ~ColumnarList() {
+        for (Columns& chunk : this->_chunks) {
+            this->releaseChunk(chunk);
+        }
+    }
+
+    // Сборка элемента из столбцов
+    T operator[](size_t idx) {
+        if (idx >= this->_listSize) {
+            throw std::out_of_range("List index is out of range!");
+        }
+
+        return this->loadAt(this->_frontOffset + idx, false, std::make_index_sequence<FIELD_COUNT>{});
+    }
+
+    // Доступ к одному полю элемента без сборки всей структуры
+    template <auto Field>
+    ColumnType<Field>& field(size_t idx) {
+        if (idx >= this->_listSize) {
+            throw std::out_of_range("List index is out of range!");
+        }
+
+        size_t position = this->_frontOffset + idx;
+        return std::get<columnIndex<Field>()>(this->_chunks[position / CHUNK_SIZE])[position % CHUNK_SIZE];
+    }
+
+    size_t getSize() const {
+        return this->_listSize;
+    }
+
+    bool isEmpty() const {
+        return this->_listSize == 0;
+    }
+
+    void pushFront(const T& value) {
+        if (this->_frontOffset == 0) {
+            this->_chunks.push_front(this->createChunk());
+            this->_frontOffset = CHUNK_SIZE;
+        }
+
+        this->storeAt(this->_frontOffset - 1, value, std::make_index_sequence<FIELD_COUNT>{});
+        --this->_frontOffset;
+        ++this->_listSize;
+    }
+
+    void pushBack(const T& value) {
+        size_t position = this->_frontOffset + this->_listSize;
+
+        if (position == this->_chunks.size() * CHUNK_SIZE) {
+            this->_chunks.push_back(this->createChunk());
+        }
+
+        this->storeAt(position, value, std::make_index_sequence<FIELD_COUNT>{});
+        ++this->_listSize;
+    }
+
+    T popFront() {
+        if (this->_listSize == 0) {
+            throw std::out_of_range("Cannot pop from empty list!");
+        }
+
+        T value = this->loadAt(this->_frontOffset, true, std::make_index_sequence<FIELD_COUNT>{});
+        ++this->_frontOffset;
+        --this->_listSize;
+
+        if (this->_listSize == 0) {
+            this->trimEmpty();
+        } else if (this->_frontOffset == CHUNK_SIZE) {
+            this->releaseChunk(this->_chunks.front());
+            this->_chunks.pop_front();
+            this->_frontOffset = 0;
+        }
+
+        return value;
+    }
+
+    T popBack() {
+        if (this->_listSize == 0) {
+            throw std::out_of_range("Cannot pop from empty list!");
+        }
+
+        --this->_listSize;
+        T value = this->loadAt(this->_frontOffset + this->_listSize, true, std::make_index_sequence<FIELD_COUNT>{});
+
+        if (this->_listSize == 0) {
+            this->trimEmpty();
+        } else if (this->_chunks.size() * CHUNK_SIZE - (this->_frontOffset + this->_listSize) >= CHUNK_SIZE) {
+            this->releaseChunk(this->_chunks.back());
+            this->_chunks.pop_back();
+        }
+
+        return value;
+    }
+
+    // Обход непрерывных участков выбранных столбцов:
+    // func(count, const Field1*, const Field2*, ...) для каждого куска
+    template <auto... Field, typename Func>
+    void forEachRun(Func func) const {
+        this->forEachRunImpl(std::index_sequence<columnIndex<Field>()...>{}, func);
+    }
+};
+
+// ============ Ядра над столбцами ============
+// Циклы внутри кусков без ветвлений и с независимыми аккумуляторами,
+// чтобы компилятор мог развернуть их в SIMD-инструкции
+
+// Сумма поля. Частичные суммы по SUM_LANES дорожкам снимают зависимость
+// между итерациями (для double без -ffast-math иначе не векторизуется)
+template <auto Field, typename ListType>
+auto columnSum(const ListType& list) {
+    using ValueType = typename ListType::template ColumnType<Field>;
+    constexpr size_t SUM_LANES = 8;
+
+    ValueType lanes[SUM_LANES] = {};
+    ValueType tail{};
+
+    list.template forEachRun<Field>([&lanes, &tail](size_t count, const ValueType* values) {
+        size_t i = 0;
+        for (; i + SUM_LANES <= count; i += SUM_LANES) {
+            for (size_t lane = 0; lane < SUM_LANES; ++lane) {
+                lanes[lane] += values[i + lane];
+            }
+        }
+        for (; i < count; ++i) {
+            tail += values[i];
+        }
+    });
+
+    for (size_t lane = 0; lane < SUM_LANES; ++lane) {
+        tail += lanes[lane];
+    }
+
+    return tail;
+}
+
+// Евклидова норма (x, y, z) каждого элемента, результаты по порядку в out
+template <auto X, auto Y, auto Z, typename ListType>
+void columnNorms(const ListType& list, std::vector<double>& out) {
+    using XType = typename ListType::template ColumnType<X>;
+    using YType = typename ListType::template ColumnType<Y>;
+    using ZType = typename ListType::template ColumnType<Z>;
+
+    out.resize(list.getSize());
+    double* result = out.data();
+
+    list.template forEachRun<X, Y, Z>([&result](size_t count, const XType* xs, const YType* ys, const ZType* zs) {
+        for (size_t i = 0; i < count; ++i) {
+            result[i] = std::sqrt(double(xs[i]) * xs[i] + double(ys[i]) * ys[i] + double(zs[i]) * zs[i]);
+        }
+        result += count;
+    });
+}
+
+// Число элементов, поле которых удовлетворяет pred
+template <auto Field, typename ListType, typename Predicate>
+size_t columnCountIf(const ListType& list, Predicate pred) {
+    using ValueType = typename ListType::template ColumnType<Field>;
+    size_t matched = 0;
+
+    list.template forEachRun<Field>([&matched, &pred](size_t count, const ValueType* values) {
+        size_t runMatched = 0;
+        for (size_t i = 0; i < count; ++i) {
+            runMatched += pred(values[i]) ? 1 : 0;
+        }
+        matched += runMatched;
+    });
+
+    return matched;
+}
+
+// Индексы элементов, поле которых удовлетворяет pred (фильтр без ветвлений)
+template <auto Field, typename ListType, typename Predicate>
+void columnSelect(const ListType& list, Predicate pred, std::vector<size_t>& out) {
+    using ValueType = typename ListType::template ColumnType<Field>;
+
+    out.resize(list.getSize());
+    size_t selected = 0;
+    size_t base = 0;
+
+    list.template forEachRun<Field>([&out, &selected, &base, &pred](size_t count, const ValueType* values) {
+        size_t* indices = out.data();
+        for (size_t i = 0; i < count; ++i) {
+            indices[selected] = base + i;
+            selected += pred(values[i]) ? 1 : 0;
+        }
+        base += count;
+    });
+
+    out.resize(selected);
+}
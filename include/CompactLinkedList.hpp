@@ -0,0 +1,386 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "NodeAllocationPolicy.hpp"
+
+// Узел компактного списка: вместо 64-битного указателя хранится 32-битное
+// смещение следующего узла от начала арены (в узлах, со сдвигом на 1,
+// 0 - конец списка). Для int узел занимает 8 байт вместо 16
+template <typename T>
+struct CompactListItem {
+    T value;
+    uint32_t nextOffset;
+};
+
+template <typename Type>
+class CompactLinkedListIterator {
+private:
+    friend Type;
+
+    Type* _pointer;
+    uint32_t _offset;
+
+public:
+    // type_traits, требуются для forward_iterator
+    using value_type = typename Type::elementType;
+    using reference = value_type&;
+    using pointer   = value_type*;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category = std::forward_iterator_tag;
+
+    CompactLinkedListIterator() : _pointer(nullptr), _offset(0) {}
+
+    CompactLinkedListIterator(Type* listPtr, uint32_t offset) : _pointer(listPtr), _offset(offset) {}
+
+    reference operator*() const {
+        if (this->_offset == Type::NULL_OFFSET) {
+            throw std::out_of_range("List index is out of range!");
+        }
+
+        return this->_pointer->itemAt(this->_offset)->value;
+    }
+
+    CompactLinkedListIterator<Type>& operator++() {
+        if (this->_offset != Type::NULL_OFFSET) {
+            this->_offset = this->_pointer->itemAt(this->_offset)->nextOffset;
+        }
+
+        return *this;
+    }
+
+    CompactLinkedListIterator<Type> operator++(int) {
+        CompactLinkedListIterator<Type> temp(*this);
+        ++(*this);
+        return temp;
+    }
+
+    bool operator==(const CompactLinkedListIterator<Type>& other) const {
+        return this->_pointer == other._pointer && this->_offset == other._offset;
+    }
+
+    bool operator!=(const CompactLinkedListIterator<Type>& other) const {
+        return !(*this == other);
+    }
+};
+
+// Односвязный список, все узлы которого лежат в одной непрерывной арене
+// (до 2^32 - 1 узлов). Связи относительные, поэтому при росте арена просто
+// переносится на новое место целиком, а для тривиально копируемого T
+// копию арены вместе с exportState() можно восстановить по другому адресу
+// через importArena() без правки связей.
+// Освобождённые узлы хранятся в списке свободных узлов внутри той же арены
+template <typename T, typename AllocatorType>
+requires std::is_default_constructible_v<T> && NodeAllocator<AllocatorType, CompactListItem<T>>
+class CompactLinkedList {
+private:
+    using ListType = CompactLinkedList<T, AllocatorType>;
+    using ItemAllocatorType = typename std::allocator_traits<AllocatorType>::template rebind_alloc<CompactListItem<T>>;
+    using ItemAllocatorTraits = std::allocator_traits<ItemAllocatorType>;
+
+    friend class CompactLinkedListIterator<ListType>;
+
+    static constexpr uint32_t NULL_OFFSET = 0;
+    static constexpr size_t MAX_CAPACITY = UINT32_MAX - 1;
+    static constexpr size_t MIN_CAPACITY = 8;
+
+    CompactListItem<T>* _arena;
+    uint32_t _capacity;
+    uint32_t _usedItems;
+    uint32_t _freeOffset;
+    uint32_t _headOffset;
+    uint32_t _tailOffset;
+    size_t _listSize;
+    ItemAllocatorType _allocator;
+
+    CompactListItem<T>* itemAt(uint32_t offset) const {
+        return this->_arena + (offset - 1);
+    }
+
+    // Перенос арены в новый блок. Смещения не меняются
+    void relocate(size_t newCapacity) {
+        if (newCapacity > MAX_CAPACITY) {
+            throw std::length_error("Compact list arena exceeds 32-bit offsets");
+        }
+
+        CompactListItem<T>* newArena = ItemAllocatorTraits::allocate(this->_allocator, newCapacity);
+
+        if constexpr (std::is_trivially_copyable_v<T>) {
+            if (this->_usedItems > 0) {
+                std::memcpy(static_cast<void*>(newArena), this->_arena, this->_usedItems * sizeof(CompactListItem<T>));
+            }
+        } else {
+            size_t moved = 0;
+            try {
+                for (; moved < this->_usedItems; ++moved) {
+                    ItemAllocatorTraits::construct(
+                        this->_allocator, newArena + moved,
+                        CompactListItem<T>{std::move_if_noexcept(this->_arena[moved].value), this->_arena[moved].nextOffset}
+                    );
+                }
+            } catch (...) {
+                for (size_t i = 0; i < moved; ++i) {
+                    ItemAllocatorTraits::destroy(this->_allocator, newArena + i);
+                }
+                ItemAllocatorTraits::deallocate(this->_allocator, newArena, newCapacity);
+                throw;
+            }
+        }
+
+        this->releaseArena();
+
+        this->_arena = newArena;
+        this->_capacity = static_cast<uint32_t>(newCapacity);
+    }
+
+    void releaseArena() {
+        if (this->_arena == nullptr) {
+            return;
+        }
+
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            for (uint32_t i = 0; i < this->_usedItems; ++i) {
+                ItemAllocatorTraits::destroy(this->_allocator, this->_arena + i);
+            }
+        }
+
+        ItemAllocatorTraits::deallocate(this->_allocator, this->_arena, this->_capacity);
+        this->_arena = nullptr;
+    }
+
+    uint32_t acquireItem(const T& value) {
+        if (this->_freeOffset != NULL_OFFSET) {
+            uint32_t offset = this->_freeOffset;
+            CompactListItem<T>* item = this->itemAt(offset);
+
+            item->value = value;
+            this->_freeOffset = item->nextOffset;
+            item->nextOffset = NULL_OFFSET;
+
+            return offset;
+        }
+
+        if (this->_usedItems == this->_capacity) {
+            // Арена уже предельного размера: удвоение не даст ни одного слота
+            if (this->_capacity == MAX_CAPACITY) {
+                throw std::length_error("Compact list arena exceeds 32-bit offsets");
+            }
+
+            this->relocate(std::min(MAX_CAPACITY, std::max<size_t>(MIN_CAPACITY, size_t(this->_capacity) * 2)));
+        }
+
+        ItemAllocatorTraits::construct(this->_allocator, this->_arena + this->_usedItems, CompactListItem<T>{value, NULL_OFFSET});
+
+        return ++this->_usedItems;
+    }
+
+    void releaseItem(uint32_t offset) {
+        CompactListItem<T>* item = this->itemAt(offset);
+
+        item->value = T{};
+        item->nextOffset = this->_freeOffset;
+        this->_freeOffset = offset;
+    }
+
+public:
+    using elementType = T;
+    using itemType = CompactListItem<T>;
+    using iterator = CompactLinkedListIterator<ListType>;
+
+    // Всё, что кроме содержимого арены нужно для восстановления списка
+    struct ArenaState {
+        uint32_t usedItems;
+        uint32_t freeOffset;
+        uint32_t headOffset;
+        uint32_t tailOffset;
+        uint64_t listSize;
+    };
+
+    CompactLinkedList(AllocatorType alloc = {}) :
+        _arena(nullptr), _capacity(0), _usedItems(0), _freeOffset(NULL_OFFSET),
+        _headOffset(NULL_OFFSET), _tailOffset(NULL_OFFSET), _listSize(0), _allocator(alloc) {}
+
+    CompactLinkedList(std::initializer_list<T> params, AllocatorType alloc = {}) : CompactLinkedList(alloc) {
+        this->reserve(params.size());
+
+        for (const T& value : params) {
+            this->pushBack(value);
+        }
+    }
+
+    CompactLinkedList(const CompactLinkedList&) = delete;
+
+    CompactLinkedList(CompactLinkedList&& other) noexcept :
+        _arena(other._arena), _capacity(other._capacity), _usedItems(other._usedItems),
+        _freeOffset(other._freeOffset), _headOffset(other._headOffset), _tailOffset(other._tailOffset),
+        _listSize(other._listSize), _allocator(other._allocator) {
+        other._arena = nullptr;
+        other._capacity = 0;
+        other._usedItems = 0;
+        other._freeOffset = NULL_OFFSET;
+        other._headOffset = NULL_OFFSET;
+        other._tailOffset = NULL_OFFSET;
+        other._listSize = 0;
+    }
+
+    ~CompactLinkedList() {
+        this->releaseArena();
+    }
+
+    // Доступ к массиву (изменение)
+    T& operator[](size_t idx) {
+        if (idx >= this->_listSize) {
+            throw std::out_of_range("List index is out of range!");
+        }
+
+        uint32_t offset = this->_headOffset;
+        for (size_t i = 1; i <= idx; ++i) {
+            offset = this->itemAt(offset)->nextOffset;
+        }
+
+        return this->itemAt(offset)->value;
+    }
+
+    size_t getSize() const {
+        return this->_listSize;
+    }
+
+    bool isEmpty() const {
+        return this->_listSize == 0;
+    }
+
+    // Ёмкость арены в узлах
+    size_t getCapacity() const {
+        return this->_capacity;
+    }
+
+    // Перенос арены в блок на count узлов заранее, чтобы вставки не переносили её повторно
+    void reserve(size_t count) {
+        if (count > this->_capacity) {
+            this->relocate(count);
+        }
+    }
+
+    void pushFront(const T& value) {
+        uint32_t offset = this->acquireItem(value);
+
+        this->itemAt(offset)->nextOffset = this->_headOffset;
+        this->_headOffset = offset;
+
+        if (this->_tailOffset == NULL_OFFSET) {
+            this->_tailOffset = offset;
+        }
+
+        ++this->_listSize;
+    }
+
+    void pushBack(const T& value) {
+        uint32_t offset = this->acquireItem(value);
+
+        if (this->_tailOffset == NULL_OFFSET) {
+            this->_headOffset = offset;
+        } else {
+            this->itemAt(this->_tailOffset)->nextOffset = offset;
+        }
+
+        this->_tailOffset = offset;
+        ++this->_listSize;
+    }
+
+    T popFront() {
+        if (this->_listSize == 0) {
+            throw std::out_of_range("Cannot pop from empty list!");
+        }
+
+        uint32_t offset = this->_headOffset;
+        CompactListItem<T>* item = this->itemAt(offset);
+        T value = std::move(item->value);
+
+        this->_headOffset = item->nextOffset;
+        if (this->_headOffset == NULL_OFFSET) {
+            this->_tailOffset = NULL_OFFSET;
+        }
+
+        this->releaseItem(offset);
+        --this->_listSize;
+
+        return value;
+    }
+
+    T popBack() {
+        if (this->_listSize == 0) {
+            throw std::out_of_range("Cannot pop from empty list!");
+        }
+
+        uint32_t offset = this->_tailOffset;
+        T value = std::move(this->itemAt(offset)->value);
+
+        if (this->_listSize == 1) {
+            this->_headOffset = NULL_OFFSET;
+            this->_tailOffset = NULL_OFFSET;
+        } else {
+            uint32_t prevOffset = this->_headOffset;
+            while (this->itemAt(prevOffset)->nextOffset != offset) {
+                prevOffset = this->itemAt(prevOffset)->nextOffset;
+            }
+
+            this->itemAt(prevOffset)->nextOffset = NULL_OFFSET;
+            this->_tailOffset = prevOffset;
+        }
+
+        this->releaseItem(offset);
+        --this->_listSize;
+
+        return value;
+    }
+
+    // Начало арены и число занятых в ней узлов
+    const CompactListItem<T>* arenaData() const {
+        return this->_arena;
+    }
+
+    size_t arenaItems() const {
+        return this->_usedItems;
+    }
+
+    ArenaState exportState() const {
+        return ArenaState{this->_usedItems, this->_freeOffset, this->_headOffset, this->_tailOffset, this->_listSize};
+    }
+
+    // Восстановление списка из копии арены, лежащей по произвольному адресу
+    static CompactLinkedList importArena(const CompactListItem<T>* items, const ArenaState& state, AllocatorType alloc = {})
+    requires std::is_trivially_copyable_v<T> {
+        CompactLinkedList list(alloc);
+
+        list.reserve(state.usedItems);
+        if (state.usedItems > 0) {
+            std::memcpy(static_cast<void*>(list._arena), items, state.usedItems * sizeof(CompactListItem<T>));
+        }
+
+        list._usedItems = state.usedItems;
+        list._freeOffset = state.freeOffset;
+        list._headOffset = state.headOffset;
+        list._tailOffset = state.tailOffset;
+        list._listSize = state.listSize;
+
+        return list;
+    }
+
+    iterator begin() {
+        return iterator(this, this->_headOffset);
+    }
+
+    iterator end() {
+        return iterator(this, NULL_OFFSET);
+    }
+};
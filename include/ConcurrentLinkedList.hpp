@@ -0,0 +1,216 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+// Односвязный список для работы как общий стек между потоками.
+// pushFront/popFront не блокируют: голова меняется CAS-ом (стек Трайбера).
+//
+// Защита от ABA: в старших 16 битах указателя на голову хранится счётчик
+// версий (tagged pointer), который увеличивается при каждой замене головы.
+// Снятые узлы не возвращаются ресурсу, а попадают во внутренний
+// lock-free список свободных узлов, поэтому чтение nextItem у узла,
+// который одновременно снял другой поток, всегда обращается к живой памяти.
+// Узлы отдаются ресурсу только в деструкторе.
+//
+// memory_resource должен быть потокобезопасным
+// (new_delete_resource, synchronized_pool_resource).
+template <typename T>
+class ConcurrentLinkedList {
+private:
+    struct ConcurrentListItem {
+        std::atomic<ConcurrentListItem*> nextItem;
+        alignas(T) unsigned char storage[sizeof(T)];
+
+        T* value() {
+            return std::launder(reinterpret_cast<T*>(this->storage));
+        }
+    };
+
+    // Указатель (младшие 48 бит) + версия (старшие 16 бит)
+    class TaggedHead {
+    private:
+        static constexpr unsigned TAG_SHIFT = 48;
+        static constexpr uint64_t POINTER_MASK = (uint64_t(1) << TAG_SHIFT) - 1;
+
+        std::atomic<uint64_t> _packed;
+
+    public:
+        TaggedHead() : _packed(0) {}
+
+        static ConcurrentListItem* pointerOf(uint64_t packed) {
+            return reinterpret_cast<ConcurrentListItem*>(static_cast<uintptr_t>(packed & POINTER_MASK));
+        }
+
+        static uint64_t repack(uint64_t oldPacked, ConcurrentListItem* item) {
+            uint64_t nextTag = ((oldPacked >> TAG_SHIFT) + 1) << TAG_SHIFT;
+            return nextTag | static_cast<uint64_t>(reinterpret_cast<uintptr_t>(item));
+        }
+
+        static bool fitsPointer(const void* item) {
+            return (static_cast<uint64_t>(reinterpret_cast<uintptr_t>(item)) & ~POINTER_MASK) == 0;
+        }
+
+        uint64_t load() const {
+            return this->_packed.load(std::memory_order_acquire);
+        }
+
+        bool compareExchange(uint64_t& expected, ConcurrentListItem* item) {
+            return this->_packed.compare_exchange_weak(
+                expected, repack(expected, item),
+                std::memory_order_acq_rel, std::memory_order_acquire
+            );
+        }
+
+        void push(ConcurrentListItem* item) {
+            uint64_t oldHead = this->load();
+            do {
+                item->nextItem.store(pointerOf(oldHead), std::memory_order_relaxed);
+            } while (!this->compareExchange(oldHead, item));
+        }
+
+        ConcurrentListItem* pop() {
+            uint64_t oldHead = this->load();
+            ConcurrentListItem* item;
+
+            do {
+                item = pointerOf(oldHead);
+                if (item == nullptr) {
+                    return nullptr;
+                }
+            } while (!this->compareExchange(oldHead, item->nextItem.load(std::memory_order_relaxed)));
+
+            return item;
+        }
+    };
+
+    static_assert(sizeof(void*) == 8, "Tagged head requires 64-bit pointers");
+
+    using AllocatorType = std::pmr::polymorphic_allocator<ConcurrentListItem>;
+
+    TaggedHead _head;
+    TaggedHead _freeItems;
+    std::atomic<size_t> _listSize;
+    AllocatorType _allocator;
+
+    ConcurrentListItem* acquireItem() {
+        ConcurrentListItem* item = this->_freeItems.pop();
+        if (item != nullptr) {
+            return item;
+        }
+
+        item = this->_allocator.allocate(1);
+        if (!TaggedHead::fitsPointer(item)) {
+            this->_allocator.deallocate(item, 1);
+            throw std::bad_alloc();
+        }
+
+        ::new (static_cast<void*>(&item->nextItem)) std::atomic<ConcurrentListItem*>(nullptr);
+        return item;
+    }
+
+    template <typename... Args>
+    void pushConstructed(Args&&... args) {
+        ConcurrentListItem* item = this->acquireItem();
+
+        try {
+            ::new (static_cast<void*>(item->storage)) T(std::forward<Args>(args)...);
+        } catch (...) {
+            this->_freeItems.push(item);
+            throw;
+        }
+
+        this->_head.push(item);
+        this->_listSize.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    static void freeChain(AllocatorType& alloc, ConcurrentListItem* item) {
+        while (item != nullptr) {
+            ConcurrentListItem* nextItem = item->nextItem.load(std::memory_order_relaxed);
+            item->nextItem.~atomic();
+            alloc.deallocate(item, 1);
+            item = nextItem;
+        }
+    }
+
+public:
+    using elementType = T;
+
+    ConcurrentLinkedList(std::pmr::polymorphic_allocator<T> alloc = {}) : _listSize(0), _allocator(alloc) {}
+
+    ConcurrentLinkedList(const ConcurrentLinkedList&) = delete;
+    ConcurrentLinkedList& operator=(const ConcurrentLinkedList&) = delete;
+
+    // Деструктор не должен выполняться одновременно с другими операциями
+    ~ConcurrentLinkedList() {
+        ConcurrentListItem* item = TaggedHead::pointerOf(this->_head.load());
+        for (ConcurrentListItem* current = item; current != nullptr; current = current->nextItem.load(std::memory_order_relaxed)) {
+            std::destroy_at(current->value());
+        }
+
+        freeChain(this->_allocator, item);
+        freeChain(this->_allocator, TaggedHead::pointerOf(this->_freeItems.load()));
+    }
+
+    void pushFront(const T& value) {
+        this->pushConstructed(value);
+    }
+
+    void pushFront(T&& value) {
+        this->pushConstructed(std::move(value));
+    }
+
+    template <typename... Args>
+    void emplaceFront(Args&&... args) {
+        this->pushConstructed(std::forward<Args>(args)...);
+    }
+
+    // Снятие элемента с головы; false, если список пуст
+    bool tryPopFront(T& out) {
+        ConcurrentListItem* item = this->_head.pop();
+        if (item == nullptr) {
+            return false;
+        }
+
+        this->_listSize.fetch_sub(1, std::memory_order_relaxed);
+
+        // После успешного CAS узел принадлежит только этому потоку
+        try {
+            out = std::move(*item->value());
+        } catch (...) {
+            std::destroy_at(item->value());
+            this->_freeItems.push(item);
+            throw;
+        }
+
+        std::destroy_at(item->value());
+        this->_freeItems.push(item);
+
+        return true;
+    }
+
+    T popFront() {
+        T value{};
+        if (!this->tryPopFront(value)) {
+            throw std::out_of_range("Cannot pop from empty list!");
+        }
+
+        return value;
+    }
+
+    // Снимок размера, при конкурентной работе может сразу устареть
+    size_t getSize() const {
+        return this->_listSize.load(std::memory_order_relaxed);
+    }
+
+    bool isEmpty() const {
+        return TaggedHead::pointerOf(this->_head.load()) == nullptr;
+    }
+};
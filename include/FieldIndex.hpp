@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace FieldIndexDetail {
+    template <auto Field, typename FieldPointer>
+    constexpr bool sameField(FieldPointer field) {
+        if constexpr (std::is_same_v<decltype(Field), FieldPointer>) {
+            return Field == field;
+        } else {
+            return false;
+        }
+    }
+
+    template <auto Field, typename Fields, size_t... I>
+    constexpr size_t fieldIndexImpl(const Fields& fields, std::index_sequence<I...>) {
+        size_t idx = sizeof...(I);
+        ((sameField<Field>(std::get<I>(fields)) && idx == sizeof...(I) ? (idx = I) : idx), ...);
+        return idx;
+    }
+}
+
+// Номер указателя на член Field в кортеже fields (описании полей в
+// ColumnarLayout / HotColdLayout); размер кортежа, если поля в нём нет
+template <auto Field, typename Fields>
+constexpr size_t fieldIndex(const Fields& fields) {
+    return FieldIndexDetail::fieldIndexImpl<Field>(fields, std::make_index_sequence<std::tuple_size_v<Fields>>{});
+}
@@ -0,0 +1,313 @@
+#pragma once
+
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "FieldIndex.hpp"
+#include "NodeAllocationPolicy.hpp"
+
+// Горячие поля структуры для HotColdList - те, по которым идут проходы
+// со сравнением ключа. Специализируется пользователем:
+//
+//   template <>
+//   struct HotColdLayout<Book> {
+//       static constexpr auto hot = std::make_tuple(&Book::year);
+//   };
+template <typename T>
+struct HotColdLayout;
+
+template <typename T>
+concept HotColdType = std::is_copy_constructible_v<T> && std::is_move_assignable_v<T> && requires {
+    std::tuple_size<std::remove_cvref_t<decltype(HotColdLayout<T>::hot)>>::value;
+};
+
+// Узел HotColdList: связь, указатель на холодную часть и горячие поля подряд
+template <typename Hot, typename Cold>
+struct HotColdItem {
+    HotColdItem* nextItem;
+    Cold* cold;
+    Hot hot;
+};
+
+// Односвязный список с разделением элемента на горячую и холодную части.
+// Горячие поля из HotColdLayout<T> лежат в узле рядом со связью, остальное
+// значение - в отдельной области: узлы и холодные части выделяются двумя
+// независимыми хранилищами AllocationPolicy (по умолчанию блоками). Проход
+// по ключу (forEachHot, findIf) читает только узлы, и на одну строку кэша
+// приходится несколько узлов, а не часть одного большого элемента.
+// Как и у ColumnarList, элементы не хранятся как объекты T целиком:
+// operator[] и pop собирают T, field<Field> даёт доступ к одному полю.
+// Холодная часть - полный объект T: выделить из произвольной структуры
+// только холодные поля нельзя. Горячие поля в ней остаются в состоянии
+// после перемещения (у скалярных полей - копией значения) и не читаются,
+// так что память под них расходуется дважды: выигрыш даёт плотность узлов
+// при проходах, а не общий объём
+template <HotColdType T, typename AllocatorType = std::allocator<T>, typename AllocationPolicy = SlabAllocation>
+class HotColdList {
+private:
+    using Fields = std::remove_cvref_t<decltype(HotColdLayout<T>::hot)>;
+
+    static constexpr size_t HOT_COUNT = std::tuple_size_v<Fields>;
+
+    template <size_t I>
+    using FieldType = std::remove_cvref_t<decltype(std::declval<T&>().*std::get<I>(HotColdLayout<T>::hot))>;
+
+    template <size_t... I>
+    static auto makeHot(std::index_sequence<I...>) -> std::tuple<FieldType<I>...>;
+
+    using Hot = decltype(makeHot(std::make_index_sequence<HOT_COUNT>{}));
+
+public:
+    using itemType = HotColdItem<Hot, T>;
+
+private:
+    using ItemAllocatorType = typename std::allocator_traits<AllocatorType>::template rebind_alloc<itemType>;
+    using ItemAllocatorTraits = std::allocator_traits<ItemAllocatorType>;
+    using ColdAllocatorType = typename std::allocator_traits<AllocatorType>::template rebind_alloc<T>;
+    using ColdAllocatorTraits = std::allocator_traits<ColdAllocatorType>;
+
+    using ItemStorageType = typename AllocationPolicy::template Storage<itemType, ItemAllocatorType>;
+    using ColdStorageType = typename AllocationPolicy::template Storage<T, ColdAllocatorType>;
+
+    itemType* _head;
+    itemType* _tail;
+    size_t _listSize;
+
+    ItemAllocatorType _itemAllocator;
+    ColdAllocatorType _coldAllocator;
+    ItemStorageType _itemStorage;
+    ColdStorageType _coldStorage;
+
+    // Горячие поля забираются из холодной части в узел; их место
+    // в холодной части остаётся занятым
+    template <size_t... I>
+    static Hot extractHot(T& cold, std::index_sequence<I...>) {
+        return Hot(std::move(cold.*std::get<I>(HotColdLayout<T>::hot))...);
+    }
+
+    // Сборка элемента; при release значение переносится из узла
+    template <size_t... I>
+    static T loadItem(itemType* item, bool release, std::index_sequence<I...>) {
+        if (release) {
+            T value(std::move(*item->cold));
+            ((value.*std::get<I>(HotColdLayout<T>::hot) = std::move(std::get<I>(item->hot))), ...);
+            return value;
+        }
+
+        T value(*item->cold);
+        ((value.*std::get<I>(HotColdLayout<T>::hot) = std::get<I>(item->hot)), ...);
+        return value;
+    }
+
+    template <typename Value>
+    itemType* createItem(Value&& value) {
+        T* cold = this->_coldStorage.acquire(this->_coldAllocator);
+
+        try {
+            ColdAllocatorTraits::construct(this->_coldAllocator, cold, std::forward<Value>(value));
+        } catch (...) {
+            this->_coldStorage.release(this->_coldAllocator, cold);
+            throw;
+        }
+
+        itemType* newItem = nullptr;
+        try {
+            newItem = this->_itemStorage.acquire(this->_itemAllocator);
+            try {
+                ItemAllocatorTraits::construct(
+                    this->_itemAllocator, newItem,
+                    itemType{nullptr, cold, extractHot(*cold, std::make_index_sequence<HOT_COUNT>{})}
+                );
+            } catch (...) {
+                this->_itemStorage.release(this->_itemAllocator, newItem);
+                throw;
+            }
+        } catch (...) {
+            ColdAllocatorTraits::destroy(this->_coldAllocator, cold);
+            this->_coldStorage.release(this->_coldAllocator, cold);
+            throw;
+        }
+
+        return newItem;
+    }
+
+    void destroyItem(itemType* item) {
+        ColdAllocatorTraits::destroy(this->_coldAllocator, item->cold);
+        this->_coldStorage.release(this->_coldAllocator, item->cold);
+
+        ItemAllocatorTraits::destroy(this->_itemAllocator, item);
+        this->_itemStorage.release(this->_itemAllocator, item);
+    }
+
+    itemType* itemAt(size_t idx) const {
+        if (idx >= this->_listSize) {
+            throw std::out_of_range("List index is out of range!");
+        }
+
+        itemType* item = this->_head;
+        for (size_t i = 0; i < idx; ++i) {
+            item = item->nextItem;
+        }
+
+        return item;
+    }
+
+public:
+    using elementType = T;
+
+    // Номер горячего поля по указателю на член; HOT_COUNT - поле холодное
+    template <auto Field>
+    static constexpr size_t hotIndex() {
+        return fieldIndex<Field>(HotColdLayout<T>::hot);
+    }
+
+    template <auto Field>
+    static constexpr bool isHot() {
+        return hotIndex<Field>() < HOT_COUNT;
+    }
+
+    template <auto Field>
+    using FieldRefType = std::remove_reference_t<decltype(std::declval<T&>().*Field)>;
+
+    HotColdList(AllocatorType alloc = {}) :
+        _head(nullptr), _tail(nullptr), _listSize(0), _itemAllocator(alloc), _coldAllocator(alloc),
+        _itemStorage(this->_itemAllocator), _coldStorage(this->_coldAllocator) {}
+
+    HotColdList(std::initializer_list<T> params, AllocatorType alloc = {}) : HotColdList(alloc) {
+        for (const T& value : params) {
+            this->pushBack(value);
+        }
+    }
+
+    HotColdList(const HotColdList&) = delete;
+
+    HotColdList(HotColdList&& other) noexcept :
+        _head(other._head), _tail(other._tail), _listSize(other._listSize),
+        _itemAllocator(other._itemAllocator), _coldAllocator(other._coldAllocator),
+        _itemStorage(std::move(other._itemStorage)), _coldStorage(std::move(other._coldStorage)) {
+        other._head = nullptr;
+        other._tail = nullptr;
+        other._listSize = 0;
+    }
+
+    ~HotColdList() {
+        this->clear();
+        this->_itemStorage.releaseAll(this->_itemAllocator);
+        this->_coldStorage.releaseAll(this->_coldAllocator);
+    }
+
+    // Сборка элемента из узла и холодной части
+    T operator[](size_t idx) const {
+        return loadItem(this->itemAt(idx), false, std::make_index_sequence<HOT_COUNT>{});
+    }
+
+    // Доступ к одному полю элемента: горячее читается из узла, холодное - из холодной части
+    template <auto Field>
+    FieldRefType<Field>& field(size_t idx) {
+        itemType* item = this->itemAt(idx);
+
+        if constexpr (isHot<Field>()) {
+            return std::get<hotIndex<Field>()>(item->hot);
+        } else {
+            return (*item->cold).*Field;
+        }
+    }
+
+    size_t getSize() const {
+        return this->_listSize;
+    }
+
+    bool isEmpty() const {
+        return this->_listSize == 0;
+    }
+
+    void clear() {
+        itemType* item = this->_head;
+
+        while (item != nullptr) {
+            itemType* nextItem = item->nextItem;
+            this->destroyItem(item);
+            item = nextItem;
+        }
+
+        this->_head = nullptr;
+        this->_tail = nullptr;
+        this->_listSize = 0;
+    }
+
+    void pushFront(const T& value) {
+        itemType* newItem = this->createItem(value);
+
+        newItem->nextItem = this->_head;
+        this->_head = newItem;
+        if (this->_tail == nullptr) {
+            this->_tail = newItem;
+        }
+
+        ++this->_listSize;
+    }
+
+    void pushBack(const T& value) {
+        itemType* newItem = this->createItem(value);
+
+        if (this->_tail == nullptr) {
+            this->_head = newItem;
+        } else {
+            this->_tail->nextItem = newItem;
+        }
+        this->_tail = newItem;
+
+        ++this->_listSize;
+    }
+
+    T popFront() {
+        if (this->_listSize == 0) {
+            throw std::out_of_range("Cannot pop from empty list!");
+        }
+
+        itemType* frontItem = this->_head;
+        T value = loadItem(frontItem, true, std::make_index_sequence<HOT_COUNT>{});
+
+        this->_head = frontItem->nextItem;
+        if (this->_head == nullptr) {
+            this->_tail = nullptr;
+        }
+
+        this->destroyItem(frontItem);
+        --this->_listSize;
+
+        return value;
+    }
+
+    // Проход только по горячим полям: func(const Field1&, const Field2&, ...)
+    // для каждого элемента, холодные части не читаются
+    template <auto... Field, typename Func>
+    void forEachHot(Func func) const {
+        static_assert((isHot<Field>() && ...), "Field is not listed in HotColdLayout");
+
+        for (itemType* item = this->_head; item != nullptr; item = item->nextItem) {
+            func(std::as_const(std::get<hotIndex<Field>()>(item->hot))...);
+        }
+    }
+
+    // Первый элемент, для горячих полей которого pred(const Field1&, ...) истинно.
+    // Холодная часть читается только у найденного элемента
+    template <auto... Field, typename Predicate>
+    std::optional<T> findIf(Predicate pred) const {
+        static_assert((isHot<Field>() && ...), "Field is not listed in HotColdLayout");
+
+        for (itemType* item = this->_head; item != nullptr; item = item->nextItem) {
+            if (pred(std::as_const(std::get<hotIndex<Field>()>(item->hot))...)) {
+                return loadItem(item, false, std::make_index_sequence<HOT_COUNT>{});
+            }
+        }
+
+        return std::nullopt;
+    }
+};
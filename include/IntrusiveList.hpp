@@ -0,0 +1,375 @@
+#pragma once
+
+#include <bit>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+
+// Проверки безопасного отвязывания: элемент нельзя вставить в список
+// повторно, отвязать не вставленный или чужой элемент или разрушить
+// вставленный. Крючок при этом хранит владеющий список, поэтому настройка
+// должна совпадать во всех единицах трансляции. По умолчанию включены
+// в отладочной сборке
+#ifndef INTRUSIVE_LIST_SAFE_UNLINK
+#ifdef NDEBUG
+#define INTRUSIVE_LIST_SAFE_UNLINK 0
+#else
+#define INTRUSIVE_LIST_SAFE_UNLINK 1
+#endif
+#endif
+
+// Крючок интрузивного списка: связи хранятся в самом элементе.
+// Встраивается базовым классом (class Student : public IntrusiveListHook)
+// или полем (IntrusiveListHook hook), тогда поле указывается в параметре списка
+class IntrusiveListHook {
+private:
+    template <typename T, IntrusiveListHook T::* Hook>
+    requires (Hook != nullptr || std::derived_from<T, IntrusiveListHook>)
+    friend class IntrusiveList;
+
+    template <typename Type, bool IsConst>
+    friend class IntrusiveListIterator;
+
+    IntrusiveListHook* _prev;
+    IntrusiveListHook* _next;
+#if INTRUSIVE_LIST_SAFE_UNLINK
+    // Список, в котором состоит элемент
+    const void* _owner = nullptr;
+#endif
+
+public:
+    IntrusiveListHook() noexcept : _prev(nullptr), _next(nullptr) {}
+
+    // Копия элемента не состоит ни в одном списке
+    IntrusiveListHook(const IntrusiveListHook&) noexcept : _prev(nullptr), _next(nullptr) {}
+
+    IntrusiveListHook& operator=(const IntrusiveListHook&) noexcept {
+        return *this;
+    }
+
+    ~IntrusiveListHook() {
+#if INTRUSIVE_LIST_SAFE_UNLINK
+        assert(!this->isLinked() && "Element is destroyed while linked into a list");
+#endif
+    }
+
+    bool isLinked() const noexcept {
+        return this->_next != nullptr;
+    }
+};
+
+// Итератор IntrusiveList. IsConst - итератор по константному списку
+template <typename Type, bool IsConst = false>
+class IntrusiveListIterator {
+private:
+    friend Type;
+    friend class IntrusiveListIterator<Type, !IsConst>;
+
+    using HookPointer = std::conditional_t<IsConst, const IntrusiveListHook*, IntrusiveListHook*>;
+
+    HookPointer _hook;
+
+public:
+    using value_type = typename Type::elementType;
+    using reference = std::conditional_t<IsConst, const value_type&, value_type&>;
+    using pointer   = std::conditional_t<IsConst, const value_type*, value_type*>;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category = std::bidirectional_iterator_tag;
+
+    IntrusiveListIterator() : _hook(nullptr) {}
+
+    explicit IntrusiveListIterator(HookPointer hook) : _hook(hook) {}
+
+    // Неконстантный итератор приводится к константному
+    template <bool OtherConst>
+    requires (IsConst && !OtherConst)
+    IntrusiveListIterator(const IntrusiveListIterator<Type, OtherConst>& other) : _hook(other._hook) {}
+
+    reference operator*() const {
+        return *Type::ownerOf(const_cast<IntrusiveListHook*>(this->_hook));
+    }
+
+    pointer operator->() const {
+        return &**this;
+    }
+
+    IntrusiveListIterator& operator++() {
+        this->_hook = this->_hook->_next;
+        return *this;
+    }
+
+    IntrusiveListIterator operator++(int) {
+        IntrusiveListIterator temp(*this);
+        ++(*this);
+        return temp;
+    }
+
+    IntrusiveListIterator& operator--() {
+        this->_hook = this->_hook->_prev;
+        return *this;
+    }
+
+    IntrusiveListIterator operator--(int) {
+        IntrusiveListIterator temp(*this);
+        --(*this);
+        return temp;
+    }
+
+    bool operator==(const IntrusiveListIterator& other) const {
+        return this->_hook == other._hook;
+    }
+
+    bool operator!=(const IntrusiveListIterator& other) const {
+        return !(*this == other);
+    }
+};
+
+// Двусвязный интрузивный список элементов, которыми владеет вызывающий код
+// (например, записи из пула). Список не выделяет память и не копирует
+// элементы: вставка, удаление и отвязывание элемента по ссылке - O(1).
+// Элемент может состоять одновременно в стольких списках, сколько у него
+// крючков. Hook - поле-крючок элемента; nullptr - крючок является базовым классом
+template <typename T, IntrusiveListHook T::* Hook = nullptr>
+requires (Hook != nullptr || std::derived_from<T, IntrusiveListHook>)
+class IntrusiveList {
+private:
+    using ListType = IntrusiveList<T, Hook>;
+
+    friend class IntrusiveListIterator<ListType>;
+    friend class IntrusiveListIterator<ListType, true>;
+
+    // Кольцо замыкается на служебный крючок списка: у пустого списка
+    // обе связи указывают на него самого
+    IntrusiveListHook _root;
+    size_t _listSize;
+
+    static IntrusiveListHook* hookOf(T& item) {
+        if constexpr (Hook == nullptr) {
+            return static_cast<IntrusiveListHook*>(&item);
+        } else {
+            return &(item.*Hook);
+        }
+    }
+
+    // Смещение поля-крючка внутри T, как в container_of. Указатель на поле
+    // в ABI Itanium (GCC, Clang) и MSVC хранит смещение поля - оно читается
+    // из Hook один раз и не требует объекта T
+    static std::ptrdiff_t hookOffset() {
+        using OffsetType = std::conditional_t<sizeof(Hook) == sizeof(std::int32_t), std::int32_t, std::ptrdiff_t>;
+        static_assert(sizeof(Hook) == sizeof(OffsetType), "Unsupported pointer-to-member layout");
+
+        static const std::ptrdiff_t offset = std::bit_cast<OffsetType>(Hook);
+        return offset;
+    }
+
+    static T* ownerOf(IntrusiveListHook* hook) {
+        if constexpr (Hook == nullptr) {
+            return static_cast<T*>(hook);
+        } else {
+            return reinterpret_cast<T*>(reinterpret_cast<std::byte*>(hook) - hookOffset());
+        }
+    }
+
+    // Отметка владельца у всех крючков списка (только с проверками)
+    void claimHooks() {
+#if INTRUSIVE_LIST_SAFE_UNLINK
+        for (IntrusiveListHook* hook = this->_root._next; hook != &this->_root; hook = hook->_next) {
+            hook->_owner = this;
+        }
+#endif
+    }
+
+    void resetRoot() {
+        this->_root._prev = &this->_root;
+        this->_root._next = &this->_root;
+        this->_listSize = 0;
+    }
+
+    void linkBefore(IntrusiveListHook* position, T& item) {
+        IntrusiveListHook* hook = hookOf(item);
+
+#if INTRUSIVE_LIST_SAFE_UNLINK
+        if (hook->isLinked()) {
+            throw std::logic_error("Element is already linked into a list!");
+        }
+#endif
+
+#if INTRUSIVE_LIST_SAFE_UNLINK
+        hook->_owner = this;
+#endif
+
+        hook->_prev = position->_prev;
+        hook->_next = position;
+        position->_prev->_next = hook;
+        position->_prev = hook;
+
+        ++this->_listSize;
+    }
+
+    void unlinkHook(IntrusiveListHook* hook) {
+        hook->_prev->_next = hook->_next;
+        hook->_next->_prev = hook->_prev;
+        hook->_prev = nullptr;
+        hook->_next = nullptr;
+#if INTRUSIVE_LIST_SAFE_UNLINK
+        hook->_owner = nullptr;
+#endif
+
+        --this->_listSize;
+    }
+
+public:
+    using elementType = T;
+    using iterator = IntrusiveListIterator<ListType>;
+    using const_iterator = IntrusiveListIterator<ListType, true>;
+
+    IntrusiveList() {
+        this->resetRoot();
+    }
+
+    IntrusiveList(const IntrusiveList&) = delete;
+    IntrusiveList& operator=(const IntrusiveList&) = delete;
+
+    // Элементы переходят в новый список, перевязываются только соседи служебного
+    // крючка. С проверками безопасного отвязывания владелец переписывается
+    // у каждого элемента - перенос становится O(n)
+    IntrusiveList(IntrusiveList&& other) noexcept {
+        if (other._listSize == 0) {
+            this->resetRoot();
+            return;
+        }
+
+        this->_root._prev = other._root._prev;
+        this->_root._next = other._root._next;
+        this->_root._prev->_next = &this->_root;
+        this->_root._next->_prev = &this->_root;
+        this->_listSize = other._listSize;
+        this->claimHooks();
+
+        other.resetRoot();
+    }
+
+    // Элементы не разрушаются, а только отвязываются
+    ~IntrusiveList() {
+        this->clear();
+        this->_root._prev = nullptr;
+        this->_root._next = nullptr;
+    }
+
+    size_t getSize() const {
+        return this->_listSize;
+    }
+
+    bool isEmpty() const {
+        return this->_listSize == 0;
+    }
+
+    T& front() {
+        if (this->_listSize == 0) {
+            throw std::out_of_range("List index is out of range!");
+        }
+
+        return *ownerOf(this->_root._next);
+    }
+
+    T& back() {
+        if (this->_listSize == 0) {
+            throw std::out_of_range("List index is out of range!");
+        }
+
+        return *ownerOf(this->_root._prev);
+    }
+
+    void pushFront(T& item) {
+        this->linkBefore(this->_root._next, item);
+    }
+
+    void pushBack(T& item) {
+        this->linkBefore(&this->_root, item);
+    }
+
+    // Вставка item перед позицией pos, возвращает итератор на item
+    iterator insert(iterator pos, T& item) {
+        this->linkBefore(pos._hook, item);
+        return iterator(hookOf(item));
+    }
+
+    // Отвязанный элемент остаётся у вызывающего кода
+    T& popFront() {
+        T& item = this->front();
+        this->unlinkHook(hookOf(item));
+        return item;
+    }
+
+    T& popBack() {
+        T& item = this->back();
+        this->unlinkHook(hookOf(item));
+        return item;
+    }
+
+    // Отвязывание элемента по ссылке за O(1). Элемент должен состоять именно
+    // в этом списке, иначе размеры обоих списков разойдутся с содержимым;
+    // с проверками безопасного отвязывания чужой элемент отвергается
+    void erase(T& item) {
+        IntrusiveListHook* hook = hookOf(item);
+
+#if INTRUSIVE_LIST_SAFE_UNLINK
+        if (!hook->isLinked()) {
+            throw std::logic_error("Element is not linked into a list!");
+        }
+        if (hook->_owner != this) {
+            throw std::logic_error("Element is linked into another list!");
+        }
+#endif
+
+        this->unlinkHook(hook);
+    }
+
+    // Отвязывание элемента в позиции pos, возвращает итератор на следующий
+    iterator erase(iterator pos) {
+        iterator next = std::next(pos);
+        this->erase(*pos);
+        return next;
+    }
+
+    // Итератор на элемент этого списка, найденный по ссылке
+    iterator iteratorTo(T& item) {
+        return iterator(hookOf(item));
+    }
+
+    void clear() {
+        IntrusiveListHook* hook = this->_root._next;
+
+        while (hook != &this->_root) {
+            IntrusiveListHook* nextHook = hook->_next;
+            hook->_prev = nullptr;
+            hook->_next = nullptr;
+#if INTRUSIVE_LIST_SAFE_UNLINK
+            hook->_owner = nullptr;
+#endif
+            hook = nextHook;
+        }
+
+        this->resetRoot();
+    }
+
+    iterator begin() {
+        return iterator(this->_root._next);
+    }
+
+    iterator end() {
+        return iterator(&this->_root);
+    }
+
+    const_iterator begin() const {
+        return const_iterator(this->_root._next);
+    }
+
+    const_iterator end() const {
+        return const_iterator(&this->_root);
+    }
+};
@@ -1,78 +1,119 @@
 #pragma once
 
-#include <memory>
+#include <algorithm>
+#include <array>
 #include <cstddef>
+#include <cstring>
+#include <functional>
 #include <initializer_list>
 #include <memory>
 #include <memory_resource>
 #include <stdexcept>
 #include <type_traits>
 #include <iterator>
+#include <ranges>
 #include <utility>
+#include <vector>
 
-template <typename Type>
+#include "ListCounters.hpp"
+#include "ListIndexPolicy.hpp"
+#include "NodeAllocationPolicy.hpp"
+
+// Итератор LinkedList. IsConst - итератор по константному списку.
+// Конец списка - std::default_sentinel: сравнение с ним проверяет только
+// текущий узел, поэтому обход идёт без подсчёта индексов
+template <typename Type, bool IsConst = false>
 class LinkedListIterator {
 private:
-    Type* _pointer;
-    size_t _size;
+    friend Type;
+    friend class LinkedListIterator<Type, !IsConst>;
+
+    using ListPointer = std::conditional_t<IsConst, const Type*, Type*>;
+    using ItemPointer = typename Type::itemType*;
+
+    // Индекс итератора, стоящего перед первым элементом (beforeBegin)
+    static constexpr size_t BEFORE_BEGIN_IDX = static_cast<size_t>(-1);
+
+    ListPointer _pointer;
+    ItemPointer _item;
     size_t _currIdx;
 
 public:
     // type_traits, требуются для forward_iterator
     using value_type = typename Type::elementType;
-    using reference = value_type&;
-    using pointer   = value_type*;
+    using reference = std::conditional_t<IsConst, const value_type&, value_type&>;
+    using pointer   = std::conditional_t<IsConst, const value_type*, value_type*>;
     using difference_type = std::ptrdiff_t;
     using iterator_category = std::forward_iterator_tag;
 
-    LinkedListIterator() : _pointer(nullptr), _size(0), _currIdx(0) {}
+    LinkedListIterator() : _pointer(nullptr), _item(nullptr), _currIdx(0) {}
+
+    LinkedListIterator(ListPointer listPtr, ItemPointer item, size_t elemIdx) :
+        _pointer(listPtr), _item(item), _currIdx(elemIdx) {}
 
-    LinkedListIterator(Type* listPtr, size_t listSize, size_t elemIdx) :
-        _pointer(listPtr), _size(listSize), _currIdx(elemIdx) {}
+    // Неконстантный итератор приводится к константному
+    template <bool OtherConst>
+    requires (IsConst && !OtherConst)
+    LinkedListIterator(const LinkedListIterator<Type, OtherConst>& other) :
+        _pointer(other._pointer), _item(other._item), _currIdx(other._currIdx) {}
 
-    reference operator*() {
-        if (this->_currIdx >= this->_size) {
+    reference operator*() const {
+        if (this->_item == nullptr) {
             throw std::out_of_range("List index is out of range!");
         }
 
-        return (*this->_pointer)[this->_currIdx].value;
+        return this->_item->value;
     }
 
-    reference operator->() {
-        return *this;
+    pointer operator->() const {
+        return &**this;
     }
 
-    LinkedListIterator<Type>& operator++() {
+    LinkedListIterator& operator++() {
+        if (this->_item != nullptr) {
+            this->_item = this->_item->nextItem.get();
+            LINKED_LIST_COUNT(nodesVisited, 1);
+        } else if (this->_currIdx == BEFORE_BEGIN_IDX) {
+            this->_item = this->_pointer->_head.get();
+        }
+
         ++this->_currIdx;
         return *this;
     }
 
-    LinkedListIterator<Type> operator++(int) {
-        LinkedListIterator<Type> temp(*this);
-        ++this->_currIdx;
+    LinkedListIterator operator++(int) {
+        LinkedListIterator temp(*this);
+        ++(*this);
         return temp;
     }
     
-    bool operator==(const LinkedListIterator<Type>& other) const {
+    // Позиции сравниваются по узлу: индекс устаревает после insertAfter,
+    // eraseAfter и spliceAfter. Без узла различаются beforeBegin и конец
+    bool operator==(const LinkedListIterator& other) const {
         return (
-            this->_currIdx == other._currIdx &&
-            this->_pointer == other._pointer
+            this->_pointer == other._pointer &&
+            this->_item == other._item &&
+            (this->_item != nullptr || (this->_currIdx == BEFORE_BEGIN_IDX) == (other._currIdx == BEFORE_BEGIN_IDX))
         );
     }
 
-    bool operator!=(const LinkedListIterator<Type>& other) const {
+    bool operator!=(const LinkedListIterator& other) const {
         return !(*this == other);
     }
+
+    bool operator==(std::default_sentinel_t) const {
+        return this->_item == nullptr && this->_currIdx != BEFORE_BEGIN_IDX;
+    }
 };
 
 // требуется для forward_iterator
 namespace std {
-    template <typename Type>
-    struct iterator_traits<LinkedListIterator<Type>> {
+    template <typename Type, bool IsConst>
+    struct iterator_traits<LinkedListIterator<Type, IsConst>> {
         using difference_type = std::ptrdiff_t;
         using value_type = typename Type::elementType;
-        using pointer = typename LinkedListIterator<Type>::pointer;
-        using reference = typename LinkedListIterator<Type>::reference;
+        using pointer = typename LinkedListIterator<Type, IsConst>::pointer;
+        using reference = typename LinkedListIterator<Type, IsConst>::reference;
         using iterator_category = std::forward_iterator_tag;
     };
 }
@@ -88,118 +129,636 @@ template <typename T>
 struct ListItem {
     T value;
     LimitedUniquePtr<ListItem<T>> nextItem;
+
+    ListItem() = default;
+
+    // Значение создаётся по протоколу uses-allocator: типы, принимающие
+    // аллокатор (std::pmr::string и т.п.), получают аллокатор списка,
+    // и их данные размещаются в том же ресурсе, что и узлы
+    template <typename AllocatorType, typename... Args>
+    ListItem(std::allocator_arg_t, const AllocatorType& alloc, Args&&... args) :
+        value(std::make_obj_using_allocator<T>(alloc, std::forward<Args>(args)...)), nextItem(nullptr) {}
+};
+
+// Программная предвыборка всех строк кэша узла
+template <typename ItemType>
+inline void prefetchListItem(const ItemType* item) {
+#if defined(__GNUC__) || defined(__clang__)
+    constexpr size_t CACHE_LINE_SIZE = 64;
+    const char* bytes = reinterpret_cast<const char*>(item);
+
+    for (size_t offset = 0; offset < sizeof(ItemType); offset += CACHE_LINE_SIZE) {
+        __builtin_prefetch(bytes + offset, 0, 3);
+    }
+#else
+    (void)item;
+#endif
+}
+
+// Итератор с предвыборкой: держит бегунок на distance узлов впереди текущего
+// и запрашивает предвыборку каждого узла, на который тот встаёт.
+// Переход по nextItem остаётся последовательным, но к приходу итератора
+// строки узла (значение и ссылка) уже в кэше, что заметно на узлах
+// из нескольких строк кэша и при тяжёлой обработке элемента
+template <typename Type>
+class LinkedListPrefetchIterator {
+private:
+    friend Type;
+
+    using ItemType = typename Type::itemType;
+
+    Type* _pointer;
+    ItemType* _item;
+    ItemType* _runner;
+    size_t _currIdx;
+
+    LinkedListPrefetchIterator(Type* listPtr, ItemType* item, size_t elemIdx, size_t distance) :
+        _pointer(listPtr), _item(item), _runner(item), _currIdx(elemIdx) {
+        for (size_t i = 0; i < distance && this->_runner != nullptr; ++i) {
+            this->_runner = this->_runner->nextItem.get();
+            if (this->_runner != nullptr) {
+                prefetchListItem(this->_runner);
+            }
+        }
+    }
+
+public:
+    using value_type = typename Type::elementType;
+    using reference = value_type&;
+    using pointer   = value_type*;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category = std::forward_iterator_tag;
+
+    LinkedListPrefetchIterator() : _pointer(nullptr), _item(nullptr), _runner(nullptr), _currIdx(0) {}
+
+    reference operator*() const {
+        if (this->_item == nullptr) {
+            throw std::out_of_range("List index is out of range!");
+        }
+
+        return this->_item->value;
+    }
+
+    LinkedListPrefetchIterator<Type>& operator++() {
+        if (this->_item != nullptr) {
+            this->_item = this->_item->nextItem.get();
+            LINKED_LIST_COUNT(nodesVisited, 1);
+        }
+
+        if (this->_runner != nullptr) {
+            this->_runner = this->_runner->nextItem.get();
+            if (this->_runner != nullptr) {
+                prefetchListItem(this->_runner);
+            }
+        }
+
+        ++this->_currIdx;
+        return *this;
+    }
+
+    LinkedListPrefetchIterator<Type> operator++(int) {
+        LinkedListPrefetchIterator<Type> temp(*this);
+        ++(*this);
+        return temp;
+    }
+
+    bool operator==(const LinkedListPrefetchIterator<Type>& other) const {
+        return this->_currIdx == other._currIdx && this->_pointer == other._pointer;
+    }
+
+    bool operator!=(const LinkedListPrefetchIterator<Type>& other) const {
+        return !(*this == other);
+    }
 };
 
-template <typename T, typename AllocatorType>
-requires std::is_default_constructible_v<T> && std::is_same_v<AllocatorType, std::pmr::polymorphic_allocator<ListItem<T>>>
+// AllocatorType может быть как std::pmr::polymorphic_allocator (динамическая
+// диспетчеризация через memory_resource), так и конкретным аллокатором
+// (например PoolAllocator), вызовы которого компилятор может встроить.
+// IndexPolicy - необязательный вторичный индекс (см. ListIndexPolicy.hpp)
+template <typename T, typename AllocatorType, typename AllocationPolicy = PerNodeAllocation, typename IndexPolicy = NoIndex>
+requires std::is_default_constructible_v<T> && NodeAllocator<AllocatorType, ListItem<T>>
 class LinkedList {
 private:
+    using ListType = LinkedList<T, AllocatorType, AllocationPolicy, IndexPolicy>;
+    using ItemAllocatorType = typename std::allocator_traits<AllocatorType>::template rebind_alloc<ListItem<T>>;
+    using ItemAllocatorTraits = std::allocator_traits<ItemAllocatorType>;
+    using StorageType = typename AllocationPolicy::template Storage<ListItem<T>, ItemAllocatorType>;
+    using IndexType = typename IndexPolicy::template Index<ListItem<T>, ItemAllocatorType>;
+
+    friend class LinkedListIterator<ListType>;
+    friend class LinkedListIterator<ListType, true>;
+    friend class LinkedListPrefetchIterator<ListType>;
+
     LimitedUniquePtr<ListItem<T>> _head;
+    ListItem<T>* _tail;
     size_t _listSize;
-    AllocatorType _allocator;
+    ItemAllocatorType _allocator;
+    StorageType _storage;
+    // Пустой NoIndex не занимает места в списке
+    [[no_unique_address]] IndexType _index;
+
+    static constexpr bool PROPAGATE_ON_MOVE = ItemAllocatorTraits::propagate_on_container_move_assignment::value;
+    // Обмен с передачей аллокаторов идёт через перемещающее присваивание
+    static constexpr bool PROPAGATE_ON_SWAP =
+        ItemAllocatorTraits::propagate_on_container_swap::value && PROPAGATE_ON_MOVE;
+
+    // Создание узла со значением, построенным из args (без связывания)
+    template <typename... Args>
+    ListItem<T>* createItem(Args&&... args) {
+        ListItem<T>* newItem = this->_storage.acquire(this->_allocator);
+        LINKED_LIST_COUNT(allocations, 1);
+
+        try {
+            ItemAllocatorTraits::construct(this->_allocator, newItem, std::allocator_arg, this->_allocator, std::forward<Args>(args)...);
+
+            // Копией считается построение из lvalue типа T
+            if constexpr ((sizeof...(Args) == 1) && (std::is_lvalue_reference_v<Args> && ...) &&
+                (std::is_same_v<std::remove_cvref_t<Args>, T> && ...)) {
+                LINKED_LIST_COUNT(copies, 1);
+            }
+        } catch (...) {
+            this->_storage.release(this->_allocator, newItem);
+            LINKED_LIST_COUNT(deallocations, 1);
+            throw;
+        }
 
-public:
-    using elementType = T;
+        if constexpr (IndexType::ENABLED) {
+            try {
+                this->_index.insert(this->_allocator, newItem);
+            } catch (...) {
+                this->disposeItem(newItem);
+                throw;
+            }
+        }
 
-    LinkedList(AllocatorType alloc = {}) : _head(nullptr), _listSize(0), _allocator(alloc) {}
+        return newItem;
+    }
 
-    LinkedList(size_t size, AllocatorType alloc = {}) : _listSize(size), _allocator(alloc) {
-        // #define ALLOC_MULTIPLE_AT_ONCE
-#ifdef ALLOC_MULTIPLE_AT_ONCE
-        ListItem<T>* rawPtr = this->_allocator.allocate(this->_listSize);
-        this->_allocator.construct(rawPtr + this->_listSize - 1);
+    // Уничтожение узла и возврат памяти аллокатору, без учёта в индексе
+    void disposeItem(ListItem<T>* item) {
+        ItemAllocatorTraits::destroy(this->_allocator, item);
+        this->_storage.release(this->_allocator, item);
+        LINKED_LIST_COUNT(deallocations, 1);
+    }
 
-        for (long long i = this->_listSize - 2; i >= 0; --i) {
-            this->_allocator.construct(rawPtr + i);
-            rawPtr[i].nextItem = std::move(LimitedUniquePtr<ListItem<T>>(rawPtr + i + 1, PolymorphicDeleter<ListItem<T>>{}));
-        }
+    // Уничтожение отвязанного узла
+    void destroyItem(ListItem<T>* item) {
+        this->_index.erase(item);
+        this->disposeItem(item);
+    }
 
-        this->_head = std::move(LimitedUniquePtr<ListItem<T>>(rawPtr, PolymorphicDeleter<ListItem<T>>{}));
-#else
-        LimitedUniquePtr<ListItem<T>> currItem = LimitedUniquePtr<ListItem<T>>(this->_allocator.allocate(1));
-        this->_allocator.construct(currItem.get());
+    // Уничтожение всех узлов списка. Для тривиально разрушаемых значений
+    // хранилище может вернуть память всех узлов разом, не обходя цепочку.
+    // keepCache - узлы возвращаются поштучно и остаются в кэше хранилища
+    void releaseNodes(bool keepCache = false) {
+        bool released = false;
+        this->_index.clear();
 
-        
-        for (long long i = this->_listSize - 2; i >= 0; --i) {
-            LimitedUniquePtr<ListItem<T>> newItem = std::move(LimitedUniquePtr<ListItem<T>>(this->_allocator.allocate(1)));
-            this->_allocator.construct(newItem.get());
+        if constexpr (std::is_trivially_destructible_v<T>) {
+            if (!keepCache) {
+                released = this->_storage.releaseWholesale(this->_allocator);
+            }
+        }
 
-            newItem.get()->nextItem = std::move(currItem);
+        if (released) {
+            this->_head.release();
+            LINKED_LIST_COUNT(deallocations, this->_listSize);
+        } else {
+            LimitedUniquePtr<ListItem<T>> currentItem = std::move(this->_head);
 
-            currItem = std::move(newItem);
+            while (currentItem != nullptr) {
+                LimitedUniquePtr<ListItem<T>> tmp = std::move(currentItem.get()->nextItem);
+                this->disposeItem(currentItem.get());
+                currentItem = std::move(tmp);
+                LINKED_LIST_COUNT(nodesVisited, 1);
+            }
         }
 
-        this->_head = std::move(currItem);
-#endif
+        this->_head = nullptr;
+        this->_tail = nullptr;
+        this->_listSize = 0;
     }
 
-    LinkedList(std::initializer_list<T> params, AllocatorType alloc = {}) : _listSize(params.size()), _allocator(alloc) {
-#ifdef ALLOC_MULTIPLE_AT_ONCE
-        ListItem<T>* rawPtr = this->_allocator.allocate(this->_listSize);
+    // Уничтожение узлов и освобождение всей памяти хранилища и индекса
+    void releaseStorage() {
+        this->releaseNodes();
+        this->_storage.releaseAll(this->_allocator);
+        this->_index.releaseAll(this->_allocator);
+    }
 
-        this->_allocator.construct(rawPtr + this->_listSize - 1);
-        rawPtr[this->_listSize - 1].value = *(params.begin() + this->_listSize - 1);
+    // Создание несвязанной с списком цепочки из count узлов одним пакетом.
+    // initItem(item) заполняет значение только что сконструированного узла.
+    // Узлы попадают в индекс одним проходом, когда все значения уже на месте
+    template <typename InitFunc>
+    std::pair<ListItem<T>*, ListItem<T>*> createChain(size_t count, InitFunc&& initItem) {
+        auto [chainHead, chainTail] = this->buildChain(count, std::forward<InitFunc>(initItem));
+
+        try {
+            this->indexChain(chainHead, count);
+        } catch (...) {
+            this->disposeChain(chainHead);
+            throw;
+        }
 
-        for (long long i = this->_listSize - 2; i >= 0; --i) {
-            this->_allocator.construct(rawPtr + i);
+        return {chainHead, chainTail};
+    }
 
-            rawPtr[i].value = *(params.begin() + i);
-            rawPtr[i].nextItem = std::move(LimitedUniquePtr<ListItem<T>>(rawPtr + i + 1, PolymorphicDeleter<ListItem<T>>{}));
+    // Цепочка для createChain, ещё не внесённая в индекс
+    template <typename InitFunc>
+    std::pair<ListItem<T>*, ListItem<T>*> buildChain(size_t count, InitFunc&& initItem) {
+        ListItem<T>* chainHead = nullptr;
+        ListItem<T>* chainTail = nullptr;
+
+        try {
+            this->_storage.acquireBatch(this->_allocator, count, [&](ListItem<T>* rawItem) {
+                LINKED_LIST_COUNT(allocations, 1);
+
+                try {
+                    ItemAllocatorTraits::construct(this->_allocator, rawItem, std::allocator_arg, this->_allocator);
+                } catch (...) {
+                    this->_storage.release(this->_allocator, rawItem);
+                    LINKED_LIST_COUNT(deallocations, 1);
+                    throw;
+                }
+
+                if (chainTail == nullptr) {
+                    chainHead = rawItem;
+                } else {
+                    chainTail->nextItem = LimitedUniquePtr<ListItem<T>>(rawItem);
+                }
+                chainTail = rawItem;
+
+                initItem(rawItem);
+            });
+        } catch (...) {
+            this->disposeChain(chainHead);
+            throw;
         }
 
-        this->_head = std::move(LimitedUniquePtr<ListItem<T>>(rawPtr, PolymorphicDeleter<ListItem<T>>{}));
-#else
-        LimitedUniquePtr<ListItem<T>> currItem = LimitedUniquePtr<ListItem<T>>(this->_allocator.allocate(1));
-        this->_allocator.construct(currItem.get());
-        currItem.get()->value =*(params.begin() + this->_listSize - 1);
-       
-        for (long long i = this->_listSize - 2; i >= 0; --i) {
-             LimitedUniquePtr<ListItem<T>> newItem = std::move(LimitedUniquePtr<ListItem<T>>(this->_allocator.allocate(1)));
-            this->_allocator.construct(newItem.get());
+        return {chainHead, chainTail};
+    }
+
+    // Уничтожение несвязанной цепочки, которой нет в индексе
+    void disposeChain(ListItem<T>* chainHead) {
+        while (chainHead != nullptr) {
+            ListItem<T>* nextItem = chainHead->nextItem.release();
+            this->disposeItem(chainHead);
+            chainHead = nextItem;
+        }
+    }
 
-            newItem.get()->value = *(params.begin() + i);
-            newItem.get()->nextItem = std::move(currItem);
+    // Значение переходит в узел другого списка перемещением, если оно
+    // не бросает исключений, иначе копированием: при ошибке источник цел
+    static constexpr bool TRANSFER_MOVES = std::is_nothrow_move_assignable_v<T> || !std::is_copy_assignable_v<T>;
 
-            currItem = std::move(newItem);
+    static void transferValue(T& target, T& source) {
+        if constexpr (TRANSFER_MOVES) {
+            target = std::move(source);
+        } else {
+            target = source;
         }
+    }
 
-        this->_head = std::move(currItem);
-#endif
+    // Возврат перемещённых transferValue значений цепочки chain в узлы source
+    static void restoreValues(ListItem<T>* chain, ListItem<T>* source) {
+        if constexpr (TRANSFER_MOVES) {
+            for (; chain != nullptr; chain = chain->nextItem.get(), source = source->nextItem.get()) {
+                source->value = std::move(chain->value);
+            }
+        }
     }
 
-    LinkedList(LinkedList& other) = delete;
-    LinkedList(LinkedList&& other) noexcept = default;
+    // Список в нашем ресурсе со значениями other. Все узлы выделяются
+    // и индексируются до того, как other теряет хоть одно значение:
+    // при ошибке other не меняется
+    LinkedList transferredFrom(LinkedList& other) {
+        LinkedList result(this->_allocator);
+        size_t count = other._listSize;
+
+        if (count > 0) {
+            auto [chainHead, chainTail] = result.buildChain(count, [](ListItem<T>*) {});
+            result.linkAfter(nullptr, chainHead, chainTail, count);
+
+            ListItem<T>* source = other._head.get();
+            for (ListItem<T>* item = chainHead; item != nullptr; item = item->nextItem.get()) {
+                transferValue(item->value, source->value);
+                source = source->nextItem.get();
+                LINKED_LIST_COUNT(nodesVisited, 1);
+            }
 
-    ~LinkedList() {
-#ifdef ALLOC_MULTIPLE_AT_ONCE
-        ListItem<T>* ptrToDealloc = this->_head.get();
-#endif
+            try {
+                result.indexChain(chainHead, count);
+            } catch (...) {
+                restoreValues(chainHead, other._head.get());
+                throw;
+            }
+        }
 
-        if (this->_listSize > 0) {
-            if constexpr (std::is_destructible_v<T>) {
-                LimitedUniquePtr<ListItem<T>> currentItem = std::move(this->_head);
+        return result;
+    }
 
-                while (currentItem != nullptr) {
-                    std::allocator_traits<AllocatorType>::destroy(
-                        this->_allocator,
-                        &(currentItem.get()->value)
-                    );
+    // Добавление count узлов, начиная с first, в индекс списка. При ошибке
+    // добавленные узлы убираются из индекса
+    void indexChain(ListItem<T>* first, size_t count) {
+        if constexpr (IndexType::ENABLED) {
+            this->_index.reserve(this->_allocator, count);
 
-                    LimitedUniquePtr<ListItem<T>> tmp = std::move(currentItem.get()->nextItem);
-#ifndef ALLOC_MULTIPLE_AT_ONCE
-                    this->_allocator.deallocate(currentItem.get(), 1);
-#endif
-                    currentItem = std::move(tmp);
+            ListItem<T>* item = first;
+            try {
+                for (size_t i = 0; i < count; ++i, item = item->nextItem.get()) {
+                    this->_index.insert(this->_allocator, item);
+                }
+            } catch (...) {
+                for (; first != item; first = first->nextItem.get()) {
+                    this->_index.erase(first);
                 }
+                throw;
             }
+        }
+    }
 
-#ifdef ALLOC_MULTIPLE_AT_ONCE
-            this->_allocator.deallocate(ptrToDealloc, this->_listSize);
-#endif
+    // Узлы из встроенного буфера хранилища source не могут сменить список:
+    // значения count таких узлов цепочки, начинающейся с link, переносятся
+    // в узлы нашего хранилища. chainTail и chainIndex - хвост и индекс списка,
+    // которому принадлежит цепочка. Память берётся заранее, поэтому при её
+    // нехватке ничего не меняется
+    void relocateInlineItems(
+        StorageType& source, IndexType& chainIndex, LimitedUniquePtr<ListItem<T>>& link, ListItem<T>*& chainTail, size_t count
+    ) {
+        static_assert(
+            std::is_nothrow_default_constructible_v<T> && std::is_nothrow_move_assignable_v<T>,
+            "Inline node storage requires nothrow default construction and move assignment"
+        );
+
+        std::array<ListItem<T>*, StorageType::INLINE_CAPACITY> targets;
+        size_t acquired = 0;
+
+        try {
+            for (; acquired < count; ++acquired) {
+                targets[acquired] = this->_storage.acquire(this->_allocator);
+            }
+        } catch (...) {
+            while (acquired > 0) {
+                this->_storage.release(this->_allocator, targets[--acquired]);
+            }
+            throw;
         }
 
-        this->_head = nullptr;
-        this->_listSize = 0;
+        LimitedUniquePtr<ListItem<T>>* currentLink = &link;
+
+        for (size_t moved = 0; moved < count; currentLink = &(*currentLink)->nextItem) {
+            ListItem<T>* item = currentLink->get();
+            if (!source.isInline(item)) {
+                continue;
+            }
+
+            ListItem<T>* target = targets[moved++];
+            ItemAllocatorTraits::construct(this->_allocator, target, std::allocator_arg, this->_allocator);
+            target->value = std::move(item->value);
+            target->nextItem = std::move(item->nextItem);
+            chainIndex.replace(item, target);
+
+            currentLink->release();
+            currentLink->reset(target);
+
+            if (chainTail == item) {
+                chainTail = target;
+            }
+
+            ItemAllocatorTraits::destroy(this->_allocator, item);
+            source.release(this->_allocator, item);
+        }
+    }
+
+    // Поэлементный перенос значений other в узлы нашего ресурса
+    // (ресурсы списков различаются). other остаётся пустым; при ошибке
+    // оба списка не меняются
+    void moveElementsFrom(LinkedList& other) {
+        LinkedList moved = this->transferredFrom(other);
+
+        *this = std::move(moved);
+        other.clear();
+    }
+
+    // count узлов other, начиная с first, переходят в наш список: переносим
+    // их в наш индекс. Из индекса other узлы убираются, только когда все они
+    // уже добавлены в наш
+    void adoptIndexEntries(LinkedList& other, ListItem<T>* first, size_t count) {
+        if constexpr (IndexType::ENABLED) {
+            this->indexChain(first, count);
+
+            for (size_t i = 0; i < count; ++i, first = first->nextItem.get()) {
+                other._index.erase(first);
+            }
+        }
+    }
+
+    // Узел, после которого выполняется вставка (nullptr - перед головой)
+    ListItem<T>* positionItem(const LinkedListIterator<ListType>& pos) {
+        if (pos._pointer != this) {
+            throw std::logic_error("Iterator does not belong to this list!");
+        }
+
+        if (pos._item == nullptr && pos._currIdx != LinkedListIterator<ListType>::BEFORE_BEGIN_IDX) {
+            throw std::out_of_range("Cannot use end iterator as position!");
+        }
+
+        return pos._item;
+    }
+
+    // Привязка цепочки [first, last] из count узлов после узла prev
+    void linkAfter(ListItem<T>* prev, ListItem<T>* first, ListItem<T>* last, size_t count) {
+        if (prev == nullptr) {
+            last->nextItem = std::move(this->_head);
+            this->_head = LimitedUniquePtr<ListItem<T>>(first);
+        } else {
+            last->nextItem = std::move(prev->nextItem);
+            prev->nextItem = LimitedUniquePtr<ListItem<T>>(first);
+        }
+
+        if (last->nextItem == nullptr) {
+            this->_tail = last;
+        }
+
+        this->_listSize += count;
+    }
+
+    // Отрезает первые count узлов цепочки start, возвращает начало остатка
+    static ListItem<T>* cutChain(ListItem<T>* start, size_t count) {
+        for (size_t i = 1; start != nullptr && i < count; ++i) {
+            start = start->nextItem.get();
+            LINKED_LIST_COUNT(nodesVisited, 1);
+        }
+
+        return (start == nullptr) ? nullptr : start->nextItem.release();
+    }
+
+    // Устойчивое слияние двух отсортированных цепочек, возвращает {голова, хвост}
+    template <typename Compare>
+    static std::pair<ListItem<T>*, ListItem<T>*> mergeChains(ListItem<T>* left, ListItem<T>* right, Compare& comp) {
+        ListItem<T>* mergedHead = nullptr;
+        ListItem<T>* mergedTail = nullptr;
+
+        auto attach = [&mergedHead, &mergedTail](ListItem<T>* item) {
+            if (mergedTail == nullptr) {
+                mergedHead = item;
+            } else {
+                mergedTail->nextItem.reset(item);
+            }
+            mergedTail = item;
+        };
+
+        while (left != nullptr && right != nullptr) {
+            LINKED_LIST_COUNT(nodesVisited, 1);
+
+            if (comp(right->value, left->value)) {
+                ListItem<T>* taken = right;
+                right = right->nextItem.release();
+                attach(taken);
+            } else {
+                ListItem<T>* taken = left;
+                left = left->nextItem.release();
+                attach(taken);
+            }
+        }
+
+        ListItem<T>* rest = (left != nullptr) ? left : right;
+        if (rest != nullptr) {
+            attach(rest);
+
+            while (mergedTail->nextItem != nullptr) {
+                mergedTail = mergedTail->nextItem.get();
+                LINKED_LIST_COUNT(nodesVisited, 1);
+            }
+        }
+
+        return {mergedHead, mergedTail};
+    }
+
+public:
+    using elementType = T;
+    using itemType = ListItem<T>;
+    using iterator = LinkedListIterator<ListType>;
+    using const_iterator = LinkedListIterator<ListType, true>;
+    using sentinel = std::default_sentinel_t;
+    using prefetchIterator = LinkedListPrefetchIterator<ListType>;
+
+    // Дальность предвыборки по умолчанию, в узлах
+    static constexpr size_t DEFAULT_PREFETCH_DISTANCE = 8;
+
+    // Размер пакета, которым removeIf возвращает память узлов
+    static constexpr size_t REMOVE_BATCH_SIZE = 64;
+
+    // Внешние указатели-переходы: каждый stride-й узел списка.
+    // Строятся одним проходом и действительны, пока список не меняется
+    struct JumpTable {
+        size_t stride;
+        std::vector<ListItem<T>*> items;
+    };
+
+    LinkedList(AllocatorType alloc = {}) :
+        _head(nullptr), _tail(nullptr), _listSize(0), _allocator(alloc), _storage(this->_allocator), _index(this->_allocator) {}
+
+    LinkedList(size_t size, AllocatorType alloc = {}) :
+        _head(nullptr), _tail(nullptr), _listSize(0), _allocator(alloc), _storage(this->_allocator), _index(this->_allocator) {
+        if (size > 0) {
+            auto [chainHead, chainTail] = this->createChain(size, [](ListItem<T>*) {});
+            this->linkAfter(nullptr, chainHead, chainTail, size);
+        }
+    }
+
+    LinkedList(std::initializer_list<T> params, AllocatorType alloc = {}) :
+        _head(nullptr), _tail(nullptr), _listSize(0), _allocator(alloc), _storage(this->_allocator), _index(this->_allocator) {
+        this->append(params.begin(), params.end());
+    }
+
+    LinkedList(LinkedList& other) = delete;
+    LinkedList(LinkedList&& other) noexcept :
+        _head(std::move(other._head)), _tail(other._tail), _listSize(other._listSize), _allocator(other._allocator),
+        _storage(std::move(other._storage)), _index(std::move(other._index)) {
+        other._tail = nullptr;
+        other._listSize = 0;
+
+        // Встроенные ячейки other свободны в нашем хранилище - выделений нет
+        if constexpr (StorageType::INLINE_CAPACITY > 0) {
+            this->relocateInlineItems(other._storage, this->_index, this->_head, this->_tail, other._storage.inlineItems());
+        }
+    }
+
+    // При равных ресурсах список забирает узлы, хранилище и индекс other за O(1)
+    // (кроме переноса встроенных узлов). Аллокатор с
+    // propagate_on_container_move_assignment переходит вместе с узлами,
+    // остальные не меняются, и значения переносятся поэлементно в наш ресурс
+    LinkedList& operator=(LinkedList&& other) {
+        if (this == &other) {
+            return *this;
+        }
+
+        if constexpr (!PROPAGATE_ON_MOVE) {
+            if (!(this->_allocator == other._allocator)) {
+                this->moveElementsFrom(other);
+                return *this;
+            }
+        }
+
+        this->releaseStorage();
+
+        if constexpr (PROPAGATE_ON_MOVE) {
+            this->_allocator = other._allocator;
+        }
+
+        std::destroy_at(&this->_storage);
+        std::construct_at(&this->_storage, std::move(other._storage));
+        std::destroy_at(&this->_index);
+        std::construct_at(&this->_index, std::move(other._index));
+
+        this->_head = std::move(other._head);
+        this->_tail = other._tail;
+        this->_listSize = other._listSize;
+        other._tail = nullptr;
+        other._listSize = 0;
+
+        if constexpr (StorageType::INLINE_CAPACITY > 0) {
+            this->relocateInlineItems(other._storage, this->_index, this->_head, this->_tail, other._storage.inlineItems());
+        }
+
+        return *this;
+    }
+
+    // Обмен содержимым за O(1) при равных ресурсах или аллокаторе
+    // с propagate_on_container_swap (аллокаторы меняются вместе с узлами).
+    // Иначе аллокаторы остаются у своих списков, а значения переносятся
+    // поэлементно; обе копии строятся до изменения списков
+    void swap(LinkedList& other) {
+        if (this == &other) {
+            return;
+        }
+
+        if (PROPAGATE_ON_SWAP || this->_allocator == other._allocator) {
+            LinkedList tmp(std::move(other));
+            other = std::move(*this);
+            *this = std::move(tmp);
+            return;
+        }
+
+        LinkedList fromOther = this->transferredFrom(other);
+        try {
+            LinkedList fromThis = other.transferredFrom(*this);
+
+            *this = std::move(fromOther);
+            other = std::move(fromThis);
+        } catch (...) {
+            restoreValues(fromOther._head.get(), other._head.get());
+            throw;
+        }
+    }
+
+    friend void swap(LinkedList& left, LinkedList& right) {
+        left.swap(right);
+    }
+
+    ~LinkedList() {
+        this->releaseStorage();
     }
 
     // Доступ к массиву (изменение)
@@ -212,6 +771,7 @@ public:
 
         for (size_t i = 1; i <= idx; ++i) {
             returnItem = (*returnItem).nextItem.get();
+            LINKED_LIST_COUNT(nodesVisited, 1);
         }
 
         return *returnItem;
@@ -236,31 +796,121 @@ public:
         return this->_listSize;
     }
 
+    // Для std::ranges::size и sized_range
+    size_t size() const {
+        return this->_listSize;
+    }
+
+    // Число элементов, которое список вместит без обращения к аллокатору
+    // (только для хранилищ с кэшем узлов, например RecyclingAllocation)
+    size_t getCapacity() const
+    requires requires(const StorageType& storage) { storage.cachedItems(); } {
+        return this->_listSize + this->_storage.cachedItems();
+    }
+
+    // Подготовка узлов одним пакетом: вставки до общего размера count
+    // не обращаются к аллокатору
+    void reserve(size_t count)
+    requires requires(StorageType& storage, ItemAllocatorType& alloc) { storage.reserve(alloc, count); } {
+        if (count > this->_listSize) {
+            this->_index.reserve(this->_allocator, count - this->_listSize);
+            this->_storage.reserve(this->_allocator, count - this->_listSize);
+        }
+    }
+
+    // Возврат аллокатору узлов из кэша; предел кэша снова равен начальному
+    void shrinkToFit()
+    requires requires(StorageType& storage, ItemAllocatorType& alloc) { storage.shrink(alloc); } {
+        this->_storage.shrink(this->_allocator);
+    }
+
+    // Удаление всех элементов; список остаётся пригодным для работы.
+    // Хранилище с кэшем узлов сохраняет их (до предела, поднятого reserve),
+    // и повторное заполнение не обращается к аллокатору
+    void clear() {
+        if constexpr (requires(const StorageType& storage) { storage.cachedItems(); }) {
+            this->releaseNodes(true);
+        } else {
+            this->releaseStorage();
+        }
+    }
+
+    // Поиск элемента по ключу индекса за O(1) в среднем; nullptr - такого нет
+    template <typename Index = IndexType>
+    requires Index::ENABLED
+    T* find(const typename Index::keyType& key) {
+        ListItem<T>* item = this->_index.find(key);
+        return (item == nullptr) ? nullptr : &item->value;
+    }
+
+    template <typename Index = IndexType>
+    requires Index::ENABLED
+    const T* find(const typename Index::keyType& key) const {
+        const ListItem<T>* item = this->_index.find(key);
+        return (item == nullptr) ? nullptr : &item->value;
+    }
+
+    // Перестроение индекса после изменения ключей на месте
+    // (через итераторы или operator[])
+    void rebuildIndex() {
+        if constexpr (IndexType::ENABLED) {
+            this->_index.clear();
+            this->indexChain(this->_head.get(), this->_listSize);
+        }
+    }
+
     void pushFront(T& value) {
-        LimitedUniquePtr<ListItem<T>> newItem = LimitedUniquePtr<ListItem<T>>(this->_allocator.allocate(1));
-        this->_allocator.construct(newItem.get());
+        this->emplaceFront(value);
+    }
+
+    void pushFront(T&& value) {
+        this->emplaceFront(std::move(value));
+    }
+
+    void pushBack(T& value) {
+        this->emplaceBack(value);
+    }
+
+    void pushBack(T&& value) {
+        this->emplaceBack(std::move(value));
+    }
+
+    // Значение строится прямо в узле из args; аллокатор-зависимые типы
+    // получают аллокатор списка (см. ListItem)
+    template <typename... Args>
+    T& emplaceFront(Args&&... args) {
+        LimitedUniquePtr<ListItem<T>> newItem = LimitedUniquePtr<ListItem<T>>(this->createItem(std::forward<Args>(args)...));
+        ListItem<T>* newHead = newItem.get();
 
-        newItem.get()->value = value;
         newItem.get()->nextItem = std::move(this->_head);
 
+        if (this->_listSize == 0) {
+            this->_tail = newHead;
+        }
+
         this->_head = std::move(newItem);
 
         ++this->_listSize;
-    }
 
-    void pushBack(T& value) {
-        LimitedUniquePtr<ListItem<T>> newItem = LimitedUniquePtr<ListItem<T>>(this->_allocator.allocate(1));
-        this->_allocator.construct(newItem.get());
+        return newHead->value;
+    }
 
-        newItem.get()->value = value;
+    template <typename... Args>
+    T& emplaceBack(Args&&... args) {
+        LimitedUniquePtr<ListItem<T>> newItem = LimitedUniquePtr<ListItem<T>>(this->createItem(std::forward<Args>(args)...));
+        ListItem<T>* newTail = newItem.get();
 
         if (this->_listSize == 0) {
             this->_head = std::move(newItem);
         } else {
-            (*this)[this->_listSize - 1].nextItem = std::move(newItem);
+            this->_tail->nextItem = std::move(newItem);
         }
 
+        this->_tail = newTail;
+
         ++this->_listSize;
+
+        return newTail->value;
     }
 
     T popFront() {
@@ -269,10 +919,12 @@ public:
         }
 
         T tmpValue = this->_head.get()->value;
+        LINKED_LIST_COUNT(copies, 1);
 
         ListItem<T>* oldHead = this->_head.get();
         if (this->_listSize == 1) {
             this->_head = nullptr;
+            this->_tail = nullptr;
         }
         else {
             auto tmp = std::move(this->_head.get()->nextItem);
@@ -280,7 +932,7 @@ public:
             this->_head = std::move(tmp);
         }
 
-        this->_allocator.deallocate(oldHead, 1);
+        this->destroyItem(oldHead);
 
         --this->_listSize;
 
@@ -292,19 +944,21 @@ public:
             throw std::out_of_range("Cannot pop from empty list!");
         }
 
-        T tmp = (*this)[this->_listSize - 1].value;
+        T tmp = this->_tail->value;
+        LINKED_LIST_COUNT(copies, 1);
 
         if (this->_listSize == 1) {
-            this->_allocator.deallocate(this->_head.get(), 1);
-            this->_head = nullptr;
+            this->destroyItem(this->_head.release());
+            this->_tail = nullptr;
         } else {
             ListItem<T>* prevItem = this->_head.get();
             for (size_t i = 1; i < this->_listSize - 1; ++i) {
                 prevItem = prevItem->nextItem.get();
+                LINKED_LIST_COUNT(nodesVisited, 1);
             }
             
-            this->_allocator.deallocate(prevItem->nextItem.get(), 1);
-            prevItem->nextItem = nullptr;
+            this->destroyItem(prevItem->nextItem.release());
+            this->_tail = prevItem;
         }
 
         --this->_listSize;
@@ -316,11 +970,491 @@ public:
         return this->getSize() == 0;
     }
 
-    LinkedListIterator<LinkedList<T, AllocatorType>> begin() {
-        return LinkedListIterator<LinkedList<T, AllocatorType>>(this, this->_listSize, 0);
+    // Вставка value после позиции pos, возвращает итератор на новый элемент
+    iterator insertAfter(iterator pos, const T& value) {
+        ListItem<T>* prevItem = this->positionItem(pos);
+        ListItem<T>* newItem = this->createItem(value);
+
+        this->linkAfter(prevItem, newItem, newItem, 1);
+
+        return iterator(this, newItem, pos._currIdx + 1);
+    }
+
+    // Удаление элемента, следующего за pos, возвращает итератор на элемент после удалённого
+    iterator eraseAfter(iterator pos) {
+        ListItem<T>* prevItem = this->positionItem(pos);
+        ListItem<T>* erasedItem = (prevItem == nullptr) ? this->_head.get() : prevItem->nextItem.get();
+
+        if (erasedItem == nullptr) {
+            throw std::out_of_range("No element after the given position!");
+        }
+
+        LimitedUniquePtr<ListItem<T>> nextItem = std::move(erasedItem->nextItem);
+        if (prevItem == nullptr) {
+            this->_head = std::move(nextItem);
+        } else {
+            prevItem->nextItem = std::move(nextItem);
+        }
+
+        if (erasedItem == this->_tail) {
+            this->_tail = prevItem;
+        }
+
+        this->destroyItem(erasedItem);
+        --this->_listSize;
+
+        ListItem<T>* followingItem = (prevItem == nullptr) ? this->_head.get() : prevItem->nextItem.get();
+        return iterator(this, followingItem, pos._currIdx + 1);
+    }
+
+    // Перенос всех элементов other после позиции pos.
+    // При общем memory_resource узлы перевязываются за O(1), иначе копируются в наш ресурс
+    void spliceAfter(iterator pos, LinkedList& other) {
+        if (&other == this || other._listSize == 0) {
+            return;
+        }
+
+        ListItem<T>* prevItem = this->positionItem(pos);
+
+        if (this->_allocator == other._allocator) {
+            if constexpr (StorageType::INLINE_CAPACITY > 0) {
+                this->relocateInlineItems(other._storage, other._index, other._head, other._tail, other._storage.inlineItems());
+            }
+            this->adoptIndexEntries(other, other._head.get(), other._listSize);
+
+            this->_storage.adopt(other._storage);
+
+            ListItem<T>* first = other._head.release();
+            this->linkAfter(prevItem, first, other._tail, other._listSize);
+
+            other._tail = nullptr;
+            other._listSize = 0;
+            return;
+        }
+
+        while (!other.isEmpty()) {
+            ListItem<T>* newItem = this->createItem(other._head->value);
+            this->linkAfter(prevItem, newItem, newItem, 1);
+            prevItem = newItem;
+
+            other.eraseAfter(other.beforeBegin());
+        }
     }
 
-    LinkedListIterator<LinkedList<T, AllocatorType>> end() {
-        return LinkedListIterator<LinkedList<T, AllocatorType>>(this, this->_listSize, this->_listSize);
+    // Перенос элементов other из интервала (first, last) после позиции pos
+    void spliceAfter(iterator pos, LinkedList& other, iterator first, iterator last) {
+        ListItem<T>* prevItem = this->positionItem(pos);
+        ListItem<T>* beforeFirst = other.positionItem(first);
+
+        if (last._pointer != &other) {
+            throw std::logic_error("Iterator does not belong to this list!");
+        }
+
+        ListItem<T>* firstMoved = (beforeFirst == nullptr) ? other._head.get() : beforeFirst->nextItem.get();
+        if (firstMoved == last._item) {
+            return;
+        }
+
+        ListItem<T>* lastMoved = firstMoved;
+        size_t count = 1;
+        size_t inlineCount = 0;
+        while (lastMoved->nextItem.get() != last._item) {
+            if (lastMoved == prevItem) {
+                throw std::logic_error("Splice position lies inside the moved range!");
+            }
+            if constexpr (StorageType::INLINE_CAPACITY > 0) {
+                inlineCount += other._storage.isInline(lastMoved) ? 1 : 0;
+            }
+
+            lastMoved = lastMoved->nextItem.get();
+            LINKED_LIST_COUNT(nodesVisited, 1);
+            ++count;
+        }
+        if constexpr (StorageType::INLINE_CAPACITY > 0) {
+            inlineCount += other._storage.isInline(lastMoved) ? 1 : 0;
+        }
+
+        if (lastMoved == prevItem) {
+            throw std::logic_error("Splice position lies inside the moved range!");
+        }
+
+        if (this != &other && !(this->_allocator == other._allocator)) {
+            for (size_t i = 0; i < count; ++i) {
+                ListItem<T>* movedItem = (beforeFirst == nullptr) ? other._head.get() : beforeFirst->nextItem.get();
+                ListItem<T>* newItem = this->createItem(movedItem->value);
+                this->linkAfter(prevItem, newItem, newItem, 1);
+                prevItem = newItem;
+
+                other.eraseAfter(first);
+            }
+
+            return;
+        }
+
+        // Встроенные узлы other переносим в наше хранилище, пока они ещё в other
+        if constexpr (StorageType::INLINE_CAPACITY > 0) {
+            if (this != &other && inlineCount > 0) {
+                LimitedUniquePtr<ListItem<T>>& link = (beforeFirst == nullptr) ? other._head : beforeFirst->nextItem;
+                this->relocateInlineItems(other._storage, other._index, link, other._tail, inlineCount);
+
+                firstMoved = link.get();
+                lastMoved = firstMoved;
+                for (size_t i = 1; i < count; ++i) {
+                    lastMoved = lastMoved->nextItem.get();
+                }
+            }
+        }
+
+        if (this != &other) {
+            this->adoptIndexEntries(other, firstMoved, count);
+        }
+
+        // Отвязываем (first, last] из other
+        LimitedUniquePtr<ListItem<T>> rest = std::move(lastMoved->nextItem);
+        if (beforeFirst == nullptr) {
+            other._head.release();
+            other._head = std::move(rest);
+        } else {
+            beforeFirst->nextItem.release();
+            beforeFirst->nextItem = std::move(rest);
+        }
+
+        if (other._tail == lastMoved) {
+            other._tail = beforeFirst;
+        }
+        other._listSize -= count;
+
+        this->_storage.adopt(other._storage);
+        this->linkAfter(prevItem, firstMoved, lastMoved, count);
+    }
+
+    // Перенос элементов other после first до конца other
+    void spliceAfter(iterator pos, LinkedList& other, iterator first, sentinel) {
+        this->spliceAfter(pos, other, first, iterator(&other, nullptr, other._listSize));
+    }
+
+    // Добавление диапазона [first, last) в конец списка.
+    // Для forward-итераторов все узлы создаются одним пакетом
+    template <std::input_iterator InputIt, std::sentinel_for<InputIt> Sentinel>
+    void append(InputIt first, Sentinel last) {
+        if (first == last) {
+            return;
+        }
+
+        if constexpr (std::forward_iterator<InputIt>) {
+            size_t count = static_cast<size_t>(std::ranges::distance(first, last));
+            auto [chainHead, chainTail] = this->createChain(count, [&first](ListItem<T>* item) {
+                item->value = *first;
+                LINKED_LIST_COUNT(copies, 1);
+                ++first;
+            });
+
+            this->linkAfter(this->_tail, chainHead, chainTail, count);
+        } else {
+            for (; first != last; ++first) {
+                ListItem<T>* newItem = this->createItem(*first);
+                this->linkAfter(this->_tail, newItem, newItem, 1);
+            }
+        }
+    }
+
+    // Добавление диапазона, в том числе ленивого представления (views)
+    template <std::ranges::input_range Range>
+    void append(Range&& range) {
+        this->append(std::ranges::begin(range), std::ranges::end(range));
+    }
+
+    // Копия списка за один проход; все узлы копии создаются одним пакетом у alloc.
+    // Тривиально копируемые значения переносятся memcpy без вызова присваивания
+    LinkedList clone(AllocatorType alloc) const {
+        LinkedList copy(alloc);
+
+        if (this->_listSize == 0) {
+            return copy;
+        }
+
+        const ListItem<T>* source = this->_head.get();
+        auto [chainHead, chainTail] = copy.createChain(this->_listSize, [&source](ListItem<T>* item) {
+            if constexpr (std::is_trivially_copyable_v<T>) {
+                std::memcpy(static_cast<void*>(&item->value), &source->value, sizeof(T));
+            } else {
+                item->value = source->value;
+            }
+            source = source->nextItem.get();
+            LINKED_LIST_COUNT(copies, 1);
+            LINKED_LIST_COUNT(nodesVisited, 1);
+        });
+
+        copy.linkAfter(nullptr, chainHead, chainTail, this->_listSize);
+
+        return copy;
+    }
+
+    LinkedList clone() const {
+        return this->clone(AllocatorType(this->_allocator));
+    }
+
+    // Устойчивая восходящая сортировка слиянием: O(n log n), O(1) доп. памяти, без выделений
+    template <typename Compare = std::less<T>>
+    void sort(Compare comp = {}) {
+        if (this->_listSize < 2) {
+            return;
+        }
+
+        ListItem<T>* chain = this->_head.release();
+
+        for (size_t width = 1; width < this->_listSize; width *= 2) {
+            ListItem<T>* sortedHead = nullptr;
+            ListItem<T>* sortedTail = nullptr;
+
+            while (chain != nullptr) {
+                ListItem<T>* left = chain;
+                ListItem<T>* right = cutChain(left, width);
+                chain = cutChain(right, width);
+
+                auto [mergedHead, mergedTail] = mergeChains(left, right, comp);
+                if (sortedTail == nullptr) {
+                    sortedHead = mergedHead;
+                } else {
+                    sortedTail->nextItem.reset(mergedHead);
+                }
+                sortedTail = mergedTail;
+            }
+
+            chain = sortedHead;
+            this->_tail = sortedTail;
+        }
+
+        this->_head.reset(chain);
+    }
+
+    // Разворот списка перевязкой узлов
+    void reverse() {
+        ListItem<T>* reversed = nullptr;
+        ListItem<T>* current = this->_head.release();
+        this->_tail = current;
+
+        while (current != nullptr) {
+            ListItem<T>* nextItem = current->nextItem.release();
+            current->nextItem.reset(reversed);
+            reversed = current;
+            current = nextItem;
+            LINKED_LIST_COUNT(nodesVisited, 1);
+        }
+
+        this->_head.reset(reversed);
+    }
+
+    // Слияние с отсортированным списком other, other становится пустым.
+    // При равенстве элементы this идут раньше элементов other
+    template <typename Compare = std::less<T>>
+    void merge(LinkedList& other, Compare comp = {}) {
+        if (&other == this || other._listSize == 0) {
+            return;
+        }
+
+        ListItem<T>* oldTail = this->_tail;
+        iterator tailPos = (oldTail == nullptr) ? this->beforeBegin() : iterator(this, oldTail, this->_listSize - 1);
+        this->spliceAfter(tailPos, other);
+
+        if (oldTail == nullptr) {
+            return;
+        }
+
+        ListItem<T>* right = oldTail->nextItem.release();
+        ListItem<T>* left = this->_head.release();
+
+        auto [mergedHead, mergedTail] = mergeChains(left, right, comp);
+        this->_head.reset(mergedHead);
+        this->_tail = mergedTail;
+    }
+
+    // Удаление подряд идущих равных элементов, возвращает число удалённых
+    template <typename BinaryPredicate = std::equal_to<T>>
+    size_t unique(BinaryPredicate pred = {}) {
+        size_t removed = 0;
+        ListItem<T>* current = this->_head.get();
+
+        while (current != nullptr && current->nextItem != nullptr) {
+            ListItem<T>* nextItem = current->nextItem.get();
+            LINKED_LIST_COUNT(nodesVisited, 1);
+
+            if (pred(current->value, nextItem->value)) {
+                current->nextItem.reset(nextItem->nextItem.release());
+                this->destroyItem(nextItem);
+                ++removed;
+            } else {
+                current = nextItem;
+            }
+        }
+
+        this->_tail = current;
+        this->_listSize -= removed;
+
+        return removed;
+    }
+
+    // Удаление всех элементов, для которых pred(value) истинно, за один проход.
+    // Память удалённых узлов возвращается хранилищу пакетами по
+    // REMOVE_BATCH_SIZE узлов. Возвращает число удалённых
+    template <typename UnaryPredicate>
+    size_t removeIf(UnaryPredicate pred) {
+        std::array<void*, REMOVE_BATCH_SIZE> pending;
+        size_t pendingCount = 0;
+        size_t removed = 0;
+
+        ListItem<T>* prevItem = nullptr;
+        ListItem<T>* current = this->_head.get();
+
+        try {
+            while (current != nullptr) {
+                ListItem<T>* nextItem = current->nextItem.get();
+                LINKED_LIST_COUNT(nodesVisited, 1);
+
+                if (pred(current->value)) {
+                    LimitedUniquePtr<ListItem<T>>& link = (prevItem == nullptr) ? this->_head : prevItem->nextItem;
+                    link.release();
+                    link.reset(current->nextItem.release());
+
+                    this->_index.erase(current);
+                    ItemAllocatorTraits::destroy(this->_allocator, current);
+                    pending[pendingCount++] = current;
+                    ++removed;
+
+                    if (pendingCount == pending.size()) {
+                        this->_storage.releaseBatch(this->_allocator, pending.data(), pendingCount);
+                        LINKED_LIST_COUNT(deallocations, pendingCount);
+                        pendingCount = 0;
+                    }
+                } else {
+                    prevItem = current;
+                }
+
+                current = nextItem;
+            }
+        } catch (...) {
+            // Исключение из pred: хвост ещё не удалён, достаточно вернуть память
+            this->_storage.releaseBatch(this->_allocator, pending.data(), pendingCount);
+            LINKED_LIST_COUNT(deallocations, pendingCount);
+            this->_listSize -= removed;
+            throw;
+        }
+
+        this->_storage.releaseBatch(this->_allocator, pending.data(), pendingCount);
+        LINKED_LIST_COUNT(deallocations, pendingCount);
+
+        this->_tail = prevItem;
+        this->_listSize -= removed;
+
+        return removed;
+    }
+
+    // Удаление всех элементов, равных value, возвращает число удалённых
+    size_t erase(const T& value) {
+        return this->removeIf([&value](const T& item) { return item == value; });
+    }
+
+    iterator beforeBegin() {
+        return iterator(this, nullptr, iterator::BEFORE_BEGIN_IDX);
+    }
+
+    iterator begin() {
+        return iterator(this, this->_head.get(), 0);
+    }
+
+    const_iterator begin() const {
+        return const_iterator(this, this->_head.get(), 0);
+    }
+
+    const_iterator cbegin() const {
+        return this->begin();
+    }
+
+    // Конец списка - сторож: список является std::ranges::forward_range
+    // и sized_range, адаптеры views строятся поверх него без копирования
+    sentinel end() const {
+        return std::default_sentinel;
+    }
+
+    sentinel cend() const {
+        return std::default_sentinel;
+    }
+
+    prefetchIterator prefetchBegin(size_t distance = DEFAULT_PREFETCH_DISTANCE) {
+        return prefetchIterator(this, this->_head.get(), 0, distance);
+    }
+
+    prefetchIterator prefetchEnd() {
+        return prefetchIterator(this, nullptr, this->_listSize, 0);
+    }
+
+    JumpTable makeJumpTable(size_t stride = 64) {
+        JumpTable table{std::max<size_t>(1, stride), {}};
+        table.items.reserve(this->_listSize / table.stride + 1);
+
+        size_t idx = 0;
+        for (ListItem<T>* item = this->_head.get(); item != nullptr; item = item->nextItem.get(), ++idx) {
+            if (idx % table.stride == 0) {
+                table.items.push_back(item);
+            }
+            LINKED_LIST_COUNT(nodesVisited, 1);
+        }
+
+        return table;
+    }
+
+    // func(value) для каждого элемента по порядку. lanes соседних участков
+    // таблицы проходятся одновременно: их переходы по nextItem независимы,
+    // и промахи кэша обслуживаются параллельно, а не один за другим.
+    // Указатели узлов группы копятся в буфере, затем func вызывается по порядку
+    template <typename Func>
+    void forEach(Func func, const JumpTable& table, size_t lanes = DEFAULT_PREFETCH_DISTANCE) {
+        lanes = std::max<size_t>(1, lanes);
+
+        std::vector<ListItem<T>*> cursors(lanes);
+        std::vector<ListItem<T>*> buffer(lanes * table.stride);
+
+        for (size_t first = 0; first < table.items.size(); first += lanes) {
+            size_t groupLanes = std::min(lanes, table.items.size() - first);
+
+            for (size_t lane = 0; lane < groupLanes; ++lane) {
+                cursors[lane] = table.items[first + lane];
+            }
+
+            size_t filled = 0;
+            for (size_t step = 0; step < table.stride; ++step) {
+                for (size_t lane = 0; lane < groupLanes; ++lane) {
+                    ListItem<T>* item = cursors[lane];
+                    if (item != nullptr) {
+                        buffer[lane * table.stride + step] = item;
+                        cursors[lane] = item->nextItem.get();
+                        LINKED_LIST_COUNT(nodesVisited, 1);
+                        ++filled;
+                    }
+                }
+            }
+
+            // Только последний участок списка может быть короче stride
+            for (size_t idx = 0; idx < filled; ++idx) {
+                func(buffer[idx]->value);
+            }
+        }
+    }
+
+    // func(value) для каждого элемента по порядку, с предвыборкой на
+    // prefetchDistance узлов вперёд (0 - без предвыборки)
+    template <typename Func>
+    void forEach(Func func, size_t prefetchDistance = DEFAULT_PREFETCH_DISTANCE) {
+        if (prefetchDistance == 0) {
+            for (ListItem<T>* item = this->_head.get(); item != nullptr; item = item->nextItem.get()) {
+                func(item->value);
+                LINKED_LIST_COUNT(nodesVisited, 1);
+            }
+            return;
+        }
+
+        for (auto it = this->prefetchBegin(prefetchDistance); it._item != nullptr; ++it) {
+            func(it._item->value);
+        }
     }
 };
\ No newline at end of file
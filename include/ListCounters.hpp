@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstddef>
+
+// Счётчики операций списка для проверки асимптотики в тестах.
+// Включаются макросом LINKED_LIST_COUNTERS при сборке; без него
+// LINKED_LIST_COUNT ничего не делает и в код не попадает.
+// Счётчики общие для всех списков потока, перед замером их сбрасывают
+#ifdef LINKED_LIST_COUNTERS
+struct LinkedListCounters {
+    size_t nodesVisited = 0;    // переходы по nextItem
+    size_t allocations = 0;     // узлы, полученные у хранилища
+    size_t deallocations = 0;   // узлы, возвращённые хранилищу
+    size_t copies = 0;          // копирования значений T
+    size_t indexProbes = 0;     // ячейки, просмотренные хеш-индексом
+
+    void reset() {
+        *this = LinkedListCounters{};
+    }
+};
+
+inline LinkedListCounters& linkedListCounters() {
+    thread_local LinkedListCounters counters;
+    return counters;
+}
+
+#define LINKED_LIST_COUNT(counter, amount) (linkedListCounters().counter += (amount))
+#else
+#define LINKED_LIST_COUNT(counter, amount) ((void)0)
+#endif
@@ -0,0 +1,494 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "ListCounters.hpp"
+
+// Политики вторичного индекса LinkedList.
+// Политика выбирается параметром шаблона списка и предоставляет вложенный
+// шаблон Index<ItemType, AllocatorType>. Список сообщает индексу о каждом
+// узле, который появляется в нём или покидает его; индекс не владеет узлами.
+// Память индекса выделяется тем же аллокатором, что и узлы.
+//
+// Интерфейс Index:
+//     static constexpr bool ENABLED                   - ведётся ли индекс
+//     void reserve(AllocatorType&, size_t)            - место ещё под count узлов
+//     void insert(AllocatorType&, ItemType*)          - узел со значением добавлен в список
+//     void erase(ItemType*)                           - узел покидает список
+//     void replace(ItemType*, ItemType*)              - значение узла перенесено в другой узел
+//                                                       (вызывается после переноса)
+//     void clear()                                    - все узлы покинули список
+//     void releaseAll(AllocatorType&)                 - освобождение памяти индекса
+// Индекс с ENABLED дополнительно предоставляет:
+//     using keyType
+//     ItemType* find(const keyType&) const
+
+// Без индекса: все операции пустые
+struct NoIndex {
+    template <typename ItemType, typename AllocatorType>
+    class Index {
+    public:
+        static constexpr bool ENABLED = false;
+
+        explicit Index(const AllocatorType&) {}
+
+        Index(Index&&) noexcept = default;
+        Index(const Index&) = delete;
+
+        void reserve(AllocatorType&, size_t) {}
+        void insert(AllocatorType&, ItemType*) {}
+        void erase(ItemType*) {}
+        void replace(ItemType*, ItemType*) {}
+        void clear() {}
+        void releaseAll(AllocatorType&) {}
+    };
+};
+
+// Хеш-индекс по ключу KeyExtractor(value): указатель на поле (&Book::title)
+// или функциональный объект без состояния. Открытая адресация с линейным
+// пробированием, find - O(1) в среднем.
+// Ячейка таблицы ключей соответствует ключу, а не узлу: узлы с равным ключом
+// образуют группу, и в ячейке хранится только первый из них вместе с хешем.
+// Остальные узлы группы связаны в двусвязную цепочку во второй таблице,
+// адресуемой указателем на узел, поэтому вставка и удаление дубликата - O(1),
+// а не проход по всей серии равных ключей.
+// Ключ элемента нельзя менять, пока элемент в списке (как в std::unordered_set).
+// При совпадающих ключах find возвращает один из таких элементов
+template <auto KeyExtractor>
+struct HashIndex {
+    template <typename ItemType, typename AllocatorType>
+    class Index {
+    private:
+        using ValueType = decltype(std::declval<ItemType&>().value);
+
+    public:
+        using keyType = std::remove_cvref_t<std::invoke_result_t<decltype(KeyExtractor), const ValueType&>>;
+
+    private:
+        // Группа узлов с равным ключом: первый узел и перемешанный хеш ключа
+        struct KeySlot {
+            ItemType* head;
+            uint64_t hash;
+        };
+
+        // Соседи узла в группе; заводятся только у групп из двух и более узлов
+        struct LinkSlot {
+            ItemType* item;
+            ItemType* prev;
+            ItemType* next;
+        };
+
+        using KeyAllocatorType = typename std::allocator_traits<AllocatorType>::template rebind_alloc<KeySlot>;
+        using KeyTraits = std::allocator_traits<KeyAllocatorType>;
+        using LinkAllocatorType = typename std::allocator_traits<AllocatorType>::template rebind_alloc<LinkSlot>;
+        using LinkTraits = std::allocator_traits<LinkAllocatorType>;
+
+        static constexpr size_t MIN_CAPACITY = 16;
+        static constexpr size_t NOT_FOUND = static_cast<size_t>(-1);
+
+        // Ячейка удалённой группы: поиск идёт дальше, вставка может её занять
+        inline static char _tombstoneMarker;
+
+        KeySlot* _keys;
+        size_t _keyCapacity;
+        size_t _groups;
+        size_t _tombstones;
+
+        LinkSlot* _links;
+        size_t _linkCapacity;
+        size_t _linkCount;
+
+        size_t _live;
+
+        static ItemType* tombstone() {
+            return reinterpret_cast<ItemType*>(&_tombstoneMarker);
+        }
+
+        static decltype(auto) keyOf(const ItemType* item) {
+            return std::invoke(KeyExtractor, item->value);
+        }
+
+        // Перемешивание Фибоначчи: std::hash для целых - тождественная функция
+        static uint64_t mix(uint64_t value) {
+            return value * 0x9E3779B97F4A7C15ull;
+        }
+
+        static uint64_t hashOf(const keyType& key) {
+            return mix(static_cast<uint64_t>(std::hash<keyType>{}(key)));
+        }
+
+        static size_t slotOf(uint64_t hash, size_t capacity) {
+            return static_cast<size_t>(hash >> (64 - std::countr_zero(capacity)));
+        }
+
+        static size_t linkHome(const ItemType* item, size_t capacity) {
+            return slotOf(mix(static_cast<uint64_t>(reinterpret_cast<uintptr_t>(item))), capacity);
+        }
+
+        // ============ Таблица ключей ============
+
+        // Ячейка группы с ключом key, NOT_FOUND - группы нет
+        size_t findGroup(const keyType& key, uint64_t hash) const {
+            if (this->_keyCapacity == 0) {
+                return NOT_FOUND;
+            }
+
+            for (size_t slot = slotOf(hash, this->_keyCapacity); ; slot = (slot + 1) & (this->_keyCapacity - 1)) {
+                LINKED_LIST_COUNT(indexProbes, 1);
+                const KeySlot& entry = this->_keys[slot];
+
+                if (entry.head == nullptr) {
+                    return NOT_FOUND;
+                }
+                if (entry.head != tombstone() && entry.hash == hash && keyOf(entry.head) == key) {
+                    return slot;
+                }
+            }
+        }
+
+        // Ячейка группы, первым узлом которой является head; ключи не сравниваются
+        size_t findHead(const ItemType* head, uint64_t hash) const {
+            if (this->_keyCapacity == 0) {
+                return NOT_FOUND;
+            }
+
+            for (size_t slot = slotOf(hash, this->_keyCapacity); ; slot = (slot + 1) & (this->_keyCapacity - 1)) {
+                LINKED_LIST_COUNT(indexProbes, 1);
+                const KeySlot& entry = this->_keys[slot];
+
+                if (entry.head == nullptr) {
+                    return NOT_FOUND;
+                }
+                if (entry.head == head && entry.hash == hash) {
+                    return slot;
+                }
+            }
+        }
+
+        void placeGroup(ItemType* head, uint64_t hash) {
+            size_t slot = slotOf(hash, this->_keyCapacity);
+            while (this->_keys[slot].head != nullptr && this->_keys[slot].head != tombstone()) {
+                LINKED_LIST_COUNT(indexProbes, 1);
+                slot = (slot + 1) & (this->_keyCapacity - 1);
+            }
+
+            if (this->_keys[slot].head == tombstone()) {
+                --this->_tombstones;
+            }
+            this->_keys[slot] = KeySlot{head, hash};
+            ++this->_groups;
+        }
+
+        // Загрузка после перестройки - не больше четверти
+        void rehashKeys(AllocatorType& alloc, size_t groupCount) {
+            size_t newCapacity = std::max(MIN_CAPACITY, std::bit_ceil(groupCount * 4));
+
+            KeyAllocatorType keyAlloc(alloc);
+            KeySlot* newKeys = KeyTraits::allocate(keyAlloc, newCapacity);
+            std::fill(newKeys, newKeys + newCapacity, KeySlot{nullptr, 0});
+
+            KeySlot* oldKeys = this->_keys;
+            size_t oldCapacity = this->_keyCapacity;
+
+            this->_keys = newKeys;
+            this->_keyCapacity = newCapacity;
+            this->_groups = 0;
+            this->_tombstones = 0;
+
+            // Хеш хранится в ячейке - ключи заново не вычисляются
+            for (size_t i = 0; i < oldCapacity; ++i) {
+                if (oldKeys[i].head != nullptr && oldKeys[i].head != tombstone()) {
+                    this->placeGroup(oldKeys[i].head, oldKeys[i].hash);
+                }
+            }
+
+            if (oldKeys != nullptr) {
+                KeyTraits::deallocate(keyAlloc, oldKeys, oldCapacity);
+            }
+        }
+
+        // ============ Таблица связей групп ============
+
+        LinkSlot* findLink(const ItemType* item) const {
+            if (this->_linkCount == 0) {
+                return nullptr;
+            }
+
+            for (size_t slot = linkHome(item, this->_linkCapacity); ; slot = (slot + 1) & (this->_linkCapacity - 1)) {
+                LINKED_LIST_COUNT(indexProbes, 1);
+
+                if (this->_links[slot].item == item) {
+                    return &this->_links[slot];
+                }
+                if (this->_links[slot].item == nullptr) {
+                    return nullptr;
+                }
+            }
+        }
+
+        // Вставка не сдвигает другие ячейки: ранее найденные указатели остаются верными
+        LinkSlot* addLink(ItemType* item, ItemType* prev, ItemType* next) {
+            size_t slot = linkHome(item, this->_linkCapacity);
+            while (this->_links[slot].item != nullptr) {
+                LINKED_LIST_COUNT(indexProbes, 1);
+                slot = (slot + 1) & (this->_linkCapacity - 1);
+            }
+
+            this->_links[slot] = LinkSlot{item, prev, next};
+            ++this->_linkCount;
+            return &this->_links[slot];
+        }
+
+        // Удаление со сдвигом следующих ячеек серии назад, без меток удаления
+        void removeLink(LinkSlot* link) {
+            size_t mask = this->_linkCapacity - 1;
+            size_t hole = static_cast<size_t>(link - this->_links);
+
+            for (size_t next = (hole + 1) & mask; this->_links[next].item != nullptr; next = (next + 1) & mask) {
+                LINKED_LIST_COUNT(indexProbes, 1);
+                size_t home = linkHome(this->_links[next].item, this->_linkCapacity);
+
+                if (((next - home) & mask) >= ((next - hole) & mask)) {
+                    this->_links[hole] = this->_links[next];
+                    hole = next;
+                }
+            }
+
+            this->_links[hole].item = nullptr;
+            --this->_linkCount;
+        }
+
+        void rehashLinks(AllocatorType& alloc, size_t linkCount) {
+            size_t newCapacity = std::max(MIN_CAPACITY, std::bit_ceil(linkCount * 4));
+
+            LinkAllocatorType linkAlloc(alloc);
+            LinkSlot* newLinks = LinkTraits::allocate(linkAlloc, newCapacity);
+            std::fill(newLinks, newLinks + newCapacity, LinkSlot{nullptr, nullptr, nullptr});
+
+            LinkSlot* oldLinks = this->_links;
+            size_t oldCapacity = this->_linkCapacity;
+
+            this->_links = newLinks;
+            this->_linkCapacity = newCapacity;
+            this->_linkCount = 0;
+
+            for (size_t i = 0; i < oldCapacity; ++i) {
+                if (oldLinks[i].item != nullptr) {
+                    this->addLink(oldLinks[i].item, oldLinks[i].prev, oldLinks[i].next);
+                }
+            }
+
+            if (oldLinks != nullptr) {
+                LinkTraits::deallocate(linkAlloc, oldLinks, oldCapacity);
+            }
+        }
+
+        // Место ещё под count связей; занятые ячейки - не больше половины таблицы
+        void reserveLinks(AllocatorType& alloc, size_t count) {
+            if ((this->_linkCount + count) * 2 > this->_linkCapacity) {
+                this->rehashLinks(alloc, this->_linkCount + count);
+            }
+        }
+
+        // Узел item покидает группу, у которой есть связи. Группа из одного
+        // оставшегося узла связей не хранит
+        void unlinkFromGroup(LinkSlot* link) {
+            ItemType* prev = link->prev;
+            ItemType* next = link->next;
+            this->removeLink(link);
+
+            LinkSlot* prevLink = (prev != nullptr) ? this->findLink(prev) : nullptr;
+            LinkSlot* nextLink = (next != nullptr) ? this->findLink(next) : nullptr;
+
+            if (prevLink != nullptr) {
+                prevLink->next = next;
+            }
+            if (nextLink != nullptr) {
+                nextLink->prev = prev;
+            }
+
+            if (prevLink != nullptr && prevLink->prev == nullptr && prevLink->next == nullptr) {
+                this->removeLink(prevLink);
+            } else if (nextLink != nullptr && nextLink->prev == nullptr && nextLink->next == nullptr) {
+                this->removeLink(nextLink);
+            }
+        }
+
+    public:
+        static constexpr bool ENABLED = true;
+
+        explicit Index(const AllocatorType&) :
+            _keys(nullptr), _keyCapacity(0), _groups(0), _tombstones(0),
+            _links(nullptr), _linkCapacity(0), _linkCount(0), _live(0) {}
+
+        Index(Index&& other) noexcept :
+            _keys(other._keys), _keyCapacity(other._keyCapacity), _groups(other._groups), _tombstones(other._tombstones),
+            _links(other._links), _linkCapacity(other._linkCapacity), _linkCount(other._linkCount), _live(other._live) {
+            other._keys = nullptr;
+            other._keyCapacity = 0;
+            other._groups = 0;
+            other._tombstones = 0;
+            other._links = nullptr;
+            other._linkCapacity = 0;
+            other._linkCount = 0;
+            other._live = 0;
+        }
+
+        Index(const Index&) = delete;
+
+        // Занятые ячейки ключей (живые и удалённые) - не больше половины таблицы.
+        // Таблица связей резервируется, только если в индексе уже есть дубликаты:
+        // первый дубликат ключа выделяет её при вставке
+        void reserve(AllocatorType& alloc, size_t count) {
+            if ((this->_groups + this->_tombstones + count) * 2 > this->_keyCapacity) {
+                this->rehashKeys(alloc, this->_groups + count);
+            }
+            if (this->_linkCount > 0) {
+                this->reserveLinks(alloc, 2 * count);
+            }
+        }
+
+        // Узел с новым ключом открывает группу, с существующим - встаёт
+        // в цепочку группы сразу за первым узлом
+        void insert(AllocatorType& alloc, ItemType* item) {
+            this->reserve(alloc, 1);
+
+            uint64_t hash = hashOf(keyOf(item));
+            size_t slot = this->findGroup(keyOf(item), hash);
+
+            if (slot == NOT_FOUND) {
+                this->placeGroup(item, hash);
+                ++this->_live;
+                return;
+            }
+
+            this->reserveLinks(alloc, 2);
+
+            ItemType* head = this->_keys[slot].head;
+            LinkSlot* headLink = this->findLink(head);
+            if (headLink == nullptr) {
+                headLink = this->addLink(head, nullptr, nullptr);
+            }
+
+            ItemType* next = headLink->next;
+            headLink->next = item;
+            this->addLink(item, head, next);
+
+            if (next != nullptr) {
+                this->findLink(next)->prev = item;
+            }
+
+            ++this->_live;
+        }
+
+        // Узлы, которых нет в индексе, пропускаются
+        void erase(ItemType* item) {
+            if (this->_live == 0) {
+                return;
+            }
+
+            size_t slot = this->findGroup(keyOf(item), hashOf(keyOf(item)));
+            if (slot == NOT_FOUND) {
+                return;
+            }
+
+            LinkSlot* link = this->findLink(item);
+
+            if (this->_keys[slot].head == item) {
+                if (link == nullptr) {
+                    this->_keys[slot].head = tombstone();
+                    --this->_groups;
+                    ++this->_tombstones;
+                } else {
+                    this->_keys[slot].head = link->next;
+                    this->unlinkFromGroup(link);
+                }
+            } else if (link != nullptr) {
+                this->unlinkFromGroup(link);
+            } else {
+                return;
+            }
+
+            --this->_live;
+        }
+
+        // Значение уже перенесено: ключ берётся из newItem. Ключ oldItem
+        // после переноса не читается - ячейка группы ищется по хешу и узлу
+        void replace(ItemType* oldItem, ItemType* newItem) {
+            if (this->_live == 0) {
+                return;
+            }
+
+            size_t slot = this->findHead(oldItem, hashOf(keyOf(newItem)));
+            if (slot != NOT_FOUND) {
+                this->_keys[slot].head = newItem;
+            }
+
+            LinkSlot* link = this->findLink(oldItem);
+            if (link == nullptr) {
+                return;
+            }
+
+            ItemType* prev = link->prev;
+            ItemType* next = link->next;
+
+            // Число связей не меняется - место в таблице есть
+            this->removeLink(link);
+            this->addLink(newItem, prev, next);
+
+            if (prev != nullptr) {
+                this->findLink(prev)->next = newItem;
+            }
+            if (next != nullptr) {
+                this->findLink(next)->prev = newItem;
+            }
+        }
+
+        ItemType* find(const keyType& key) const {
+            if (this->_live == 0) {
+                return nullptr;
+            }
+
+            size_t slot = this->findGroup(key, hashOf(key));
+            return (slot == NOT_FOUND) ? nullptr : this->_keys[slot].head;
+        }
+
+        void clear() {
+            if (this->_keys != nullptr) {
+                std::fill(this->_keys, this->_keys + this->_keyCapacity, KeySlot{nullptr, 0});
+            }
+            if (this->_links != nullptr) {
+                std::fill(this->_links, this->_links + this->_linkCapacity, LinkSlot{nullptr, nullptr, nullptr});
+            }
+
+            this->_groups = 0;
+            this->_tombstones = 0;
+            this->_linkCount = 0;
+            this->_live = 0;
+        }
+
+        void releaseAll(AllocatorType& alloc) {
+            if (this->_keys != nullptr) {
+                KeyAllocatorType keyAlloc(alloc);
+                KeyTraits::deallocate(keyAlloc, this->_keys, this->_keyCapacity);
+            }
+            if (this->_links != nullptr) {
+                LinkAllocatorType linkAlloc(alloc);
+                LinkTraits::deallocate(linkAlloc, this->_links, this->_linkCapacity);
+            }
+
+            this->_keys = nullptr;
+            this->_keyCapacity = 0;
+            this->_links = nullptr;
+            this->_linkCapacity = 0;
+            this->clear();
+        }
+    };
+};
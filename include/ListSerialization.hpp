@@ -0,0 +1,229 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// Двоичное сохранение и загрузка LinkedList.
+//
+// Формат: заголовок { "LLST", версия, размер элемента, число элементов },
+// затем значения по порядку. Числа пишутся в порядке байт машины, поэтому
+// снимок переносим только между машинами с одинаковым порядком байт.
+//
+// Тривиально копируемые T пишутся и читаются блоками через промежуточный
+// буфер, без вызова потока на каждый элемент. Остальные типы требуют
+// специализации ListCodec<T> (для std::string она уже есть).
+
+template <typename T>
+struct ListCodec;
+
+template <>
+struct ListCodec<std::string> {
+    static void write(std::ostream& out, const std::string& value) {
+        uint64_t length = value.size();
+        out.write(reinterpret_cast<const char*>(&length), sizeof(length));
+        out.write(value.data(), static_cast<std::streamsize>(length));
+    }
+
+    // Длина и хотя бы пустое содержимое
+    static constexpr size_t MIN_ENCODED_SIZE = sizeof(uint64_t);
+
+    // Длина берётся из потока и не проверена: строка растёт порциями по мере
+    // чтения, и испорченная длина не приводит к огромному выделению
+    static void read(std::istream& in, std::string& value) {
+        constexpr uint64_t CHUNK_SIZE = 64 * 1024;
+
+        uint64_t length = 0;
+        in.read(reinterpret_cast<char*>(&length), sizeof(length));
+        if (!in) {
+            return;
+        }
+
+        value.clear();
+        while (value.size() < length) {
+            size_t offset = value.size();
+            size_t chunk = static_cast<size_t>(std::min(CHUNK_SIZE, length - offset));
+
+            value.resize(offset + chunk);
+            in.read(value.data() + offset, static_cast<std::streamsize>(chunk));
+            if (!in) {
+                return;
+            }
+        }
+    }
+};
+
+template <typename T>
+concept BulkSerializable = std::is_trivially_copyable_v<T>;
+
+template <typename T>
+concept CodecSerializable = requires(std::ostream& out, std::istream& in, const T& constValue, T& value) {
+    ListCodec<T>::write(out, constValue);
+    ListCodec<T>::read(in, value);
+};
+
+namespace ListSerializationDetail {
+    inline constexpr char MAGIC[4] = {'L', 'L', 'S', 'T'};
+    inline constexpr uint32_t VERSION = 1;
+    inline constexpr size_t BUFFER_SIZE = 64 * 1024;
+
+    // Для типов с кодеком размер элемента не фиксирован
+    template <typename T>
+    constexpr uint32_t elementSize() {
+        if constexpr (BulkSerializable<T>) {
+            return sizeof(T);
+        } else {
+            return 0;
+        }
+    }
+
+    // Наименьший размер записи одного элемента; 0 - не известен
+    template <typename T>
+    constexpr size_t minEncodedSize() {
+        if constexpr (BulkSerializable<T>) {
+            return sizeof(T);
+        } else if constexpr (requires { ListCodec<T>::MIN_ENCODED_SIZE; }) {
+            return ListCodec<T>::MIN_ENCODED_SIZE;
+        } else {
+            return 0;
+        }
+    }
+
+    // Байт до конца потока; для потока без позиционирования - не ограничено
+    inline uint64_t remainingBytes(std::istream& in) {
+        std::istream::pos_type current = in.tellg();
+        if (current == std::istream::pos_type(-1)) {
+            return UINT64_MAX;
+        }
+
+        in.seekg(0, std::ios::end);
+        std::istream::pos_type end = in.tellg();
+        in.clear();
+        in.seekg(current);
+
+        if (end == std::istream::pos_type(-1) || end < current) {
+            return UINT64_MAX;
+        }
+
+        return static_cast<uint64_t>(end - current);
+    }
+
+    struct Header {
+        char magic[4];
+        uint32_t version;
+        uint32_t elementSize;
+        uint32_t reserved;
+        uint64_t count;
+    };
+
+    inline void checkStream(const std::ios& stream, const char* message) {
+        if (!stream) {
+            throw std::runtime_error(message);
+        }
+    }
+}
+
+template <typename ListType>
+requires BulkSerializable<typename ListType::elementType> || CodecSerializable<typename ListType::elementType>
+void saveList(ListType& list, std::ostream& out) {
+    using T = typename ListType::elementType;
+    using namespace ListSerializationDetail;
+
+    Header header{{MAGIC[0], MAGIC[1], MAGIC[2], MAGIC[3]}, VERSION, elementSize<T>(), 0, list.getSize()};
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    if constexpr (BulkSerializable<T>) {
+        constexpr size_t ITEMS_PER_BUFFER = std::max<size_t>(1, BUFFER_SIZE / sizeof(T));
+        std::vector<T> buffer(std::min<size_t>(ITEMS_PER_BUFFER, list.getSize()));
+        size_t buffered = 0;
+
+        for (auto it = list.begin(); it != list.end(); ++it) {
+            std::memcpy(static_cast<void*>(buffer.data() + buffered), &*it, sizeof(T));
+
+            if (++buffered == buffer.size()) {
+                out.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffered * sizeof(T)));
+                buffered = 0;
+            }
+        }
+
+        if (buffered > 0) {
+            out.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffered * sizeof(T)));
+        }
+    } else {
+        for (auto it = list.begin(); it != list.end(); ++it) {
+            ListCodec<T>::write(out, *it);
+        }
+    }
+
+    checkStream(out, "Failed to write list");
+}
+
+// Узлы создаются одним пакетом у аллокатора alloc, затем заполняются из потока
+template <typename ListType, typename AllocatorType>
+requires BulkSerializable<typename ListType::elementType> || CodecSerializable<typename ListType::elementType>
+ListType loadList(std::istream& in, AllocatorType alloc) {
+    using T = typename ListType::elementType;
+    using namespace ListSerializationDetail;
+
+    Header header{};
+    in.read(reinterpret_cast<char*>(&header), sizeof(header));
+    checkStream(in, "Failed to read list header");
+
+    if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 || header.version != VERSION) {
+        throw std::runtime_error("Stream does not contain a serialized list");
+    }
+    if (header.elementSize != elementSize<T>()) {
+        throw std::runtime_error("Serialized element type does not match");
+    }
+
+    // Число элементов из заголовка задаёт размер пакета узлов - оно не может
+    // превышать то, что помещается в остаток потока
+    if constexpr (minEncodedSize<T>() > 0) {
+        if (header.count > remainingBytes(in) / minEncodedSize<T>()) {
+            throw std::runtime_error("Serialized list is truncated");
+        }
+    }
+
+    ListType list(static_cast<size_t>(header.count), alloc);
+
+    if constexpr (BulkSerializable<T>) {
+        constexpr size_t ITEMS_PER_BUFFER = std::max<size_t>(1, BUFFER_SIZE / sizeof(T));
+        std::vector<T> buffer(std::min<size_t>(ITEMS_PER_BUFFER, list.getSize()));
+        size_t buffered = 0;
+        size_t consumed = 0;
+        size_t remaining = list.getSize();
+
+        for (auto it = list.begin(); it != list.end(); ++it) {
+            if (consumed == buffered) {
+                buffered = std::min(buffer.size(), remaining);
+                in.read(reinterpret_cast<char*>(buffer.data()), static_cast<std::streamsize>(buffered * sizeof(T)));
+                checkStream(in, "Serialized list is truncated");
+
+                remaining -= buffered;
+                consumed = 0;
+            }
+
+            std::memcpy(static_cast<void*>(&*it), buffer.data() + consumed, sizeof(T));
+            ++consumed;
+        }
+    } else {
+        for (auto it = list.begin(); it != list.end(); ++it) {
+            ListCodec<T>::read(in, *it);
+            checkStream(in, "Serialized list is truncated");
+        }
+    }
+
+    // Значения записаны на место узлов - индекс списка строится заново
+    if constexpr (requires { list.rebuildIndex(); }) {
+        list.rebuildIndex();
+    }
+
+    return list;
+}
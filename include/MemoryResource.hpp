@@ -1,11 +1,13 @@
 #pragma once
 
+#include "BatchMemoryResource.hpp"
+
 #include <memory_resource>
 #include <list>
 
 #define BUFFER_SIZE 5000
 
-class MemoryResource : public std::pmr::memory_resource {
+class MemoryResource : public BatchMemoryResource {
 private:
     struct BufferBlock {
         BufferBlock() {};
@@ -24,5 +26,6 @@ public:
 
     void* do_allocate(size_t, size_t) override;
     void do_deallocate(void*, size_t, size_t) override;
+    void do_deallocate_batch(void**, size_t, size_t, size_t) override;
     bool do_is_equal(const std::pmr::memory_resource&) const noexcept override;
 };
\ No newline at end of file
@@ -0,0 +1,602 @@
+#pragma once
+
+#include "BatchMemoryResource.hpp"
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <stdexcept>
+#include <vector>
+
+// Аллокатор, пригодный для узлов списка: любой стандартный аллокатор,
+// который можно перепривязать (rebind) к типу узла ItemType
+template <typename AllocatorType, typename ItemType>
+concept NodeAllocator = requires(
+    typename std::allocator_traits<AllocatorType>::template rebind_alloc<ItemType> alloc,
+    ItemType* item, size_t count
+) {
+    { std::allocator_traits<decltype(alloc)>::allocate(alloc, count) } -> std::same_as<ItemType*>;
+    std::allocator_traits<decltype(alloc)>::deallocate(alloc, item, count);
+    { alloc == alloc } -> std::convertible_to<bool>;
+};
+
+// Возврат памяти count отдельно выделенных узлов одним вызовом, если ресурс
+// полиморфного аллокатора это умеет, иначе - по одному узлу
+template <typename ItemType, typename AllocatorType>
+void deallocateNodes(AllocatorType& alloc, void** items, size_t count) {
+    if (count == 0) {
+        return;
+    }
+
+    if constexpr (requires { { alloc.resource() } -> std::convertible_to<std::pmr::memory_resource*>; }) {
+        if (auto* batchResource = dynamic_cast<BatchMemoryResource*>(alloc.resource())) {
+            batchResource->deallocateBatch(items, count, sizeof(ItemType), alignof(ItemType));
+            return;
+        }
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        std::allocator_traits<AllocatorType>::deallocate(alloc, static_cast<ItemType*>(items[i]), 1);
+    }
+}
+
+// Политики выделения памяти под узлы LinkedList.
+// Политика выбирается параметром шаблона списка и предоставляет вложенный
+// шаблон Storage<ItemType, AllocatorType>, через который список получает
+// и возвращает сырую память под узлы. Конструирование и уничтожение узлов
+// остаётся на стороне списка.
+//
+// Интерфейс Storage:
+//     ItemType* acquire(AllocatorType&)                       - память под один узел
+//     void acquireBatch(AllocatorType&, size_t, Callback&&)   - память под count узлов,
+//                                                               callback вызывается для каждого
+//     void release(AllocatorType&, ItemType*)                 - возврат памяти одного узла
+//     void releaseBatch(AllocatorType&, void**, size_t)       - возврат памяти count узлов
+//                                                               (адреса ItemType*, порядок может меняться)
+//     void adopt(Storage&)                                    - учёт узлов, перенесённых из другого списка
+//     bool releaseWholesale(AllocatorType&)                   - возврат памяти всех узлов разом без обхода;
+//                                                               false, если так освободить нельзя
+//     void releaseAll(AllocatorType&)                         - освобождение служебных данных
+//     static constexpr size_t INLINE_CAPACITY                 - число узлов, размещаемых внутри
+//                                                               самого хранилища (обычно 0)
+//
+// Хранилища с ненулевым INLINE_CAPACITY дополнительно предоставляют:
+//     size_t inlineItems() const                              - число живых узлов внутри хранилища
+//     bool isInline(const ItemType*) const                    - лежит ли узел внутри хранилища
+// Такие узлы перемещаются вместе с объектом списка, поэтому при перемещении
+// списка и переносе узлов в другой список их значения переносятся в новые узлы
+//
+// Хранилища с кэшем освобождённых узлов дополнительно предоставляют:
+//     void reserve(AllocatorType&, size_t)                    - не меньше count узлов в кэше
+//     size_t cachedItems() const                              - число узлов в кэше
+//     void shrink(AllocatorType&)                             - освобождение кэша
+// Список сохраняет кэш при clear() и освобождает его в деструкторе или shrinkToFit()
+
+// Каждый узел выделяется отдельным вызовом аллокатора
+struct PerNodeAllocation {
+    template <typename ItemType, typename AllocatorType>
+    class Storage {
+    private:
+        using Traits = std::allocator_traits<AllocatorType>;
+
+    public:
+        static constexpr size_t INLINE_CAPACITY = 0;
+
+        explicit Storage(const AllocatorType&) {}
+
+        Storage(Storage&&) noexcept = default;
+        Storage(const Storage&) = delete;
+
+        ItemType* acquire(AllocatorType& alloc) {
+            return Traits::allocate(alloc, 1);
+        }
+
+        template <typename Callback>
+        void acquireBatch(AllocatorType& alloc, size_t count, Callback&& onItem) {
+            for (size_t i = 0; i < count; ++i) {
+                onItem(Traits::allocate(alloc, 1));
+            }
+        }
+
+        void release(AllocatorType& alloc, ItemType* item) {
+            Traits::deallocate(alloc, item, 1);
+        }
+
+        void releaseBatch(AllocatorType& alloc, void** items, size_t count) {
+            deallocateNodes<ItemType>(alloc, items, count);
+        }
+
+        void adopt(Storage&) {}
+
+        bool releaseWholesale(AllocatorType&) {
+            return false;
+        }
+
+        void releaseAll(AllocatorType&) {}
+    };
+};
+
+// Узлы выделяются непрерывными блоками (slab).
+// Пакетные операции (конструкторы, append) берут один блок ровно под пакет,
+// одиночные вставки заполняют текущий открытый блок, размер которого растёт
+// геометрически. Блок возвращается аллокатору, когда в нём не остаётся живых
+// узлов и ни один список больше не ссылается на него.
+struct SlabAllocation {
+    template <typename ItemType, typename AllocatorType>
+    class Storage {
+    private:
+        using Traits = std::allocator_traits<AllocatorType>;
+
+        // Заголовок блока, размещается в первых элементах самого блока
+        struct SlabHeader {
+            size_t capacity;
+            size_t live;
+            size_t owners;
+        };
+
+        static constexpr size_t HEADER_ITEMS = (sizeof(SlabHeader) + sizeof(ItemType) - 1) / sizeof(ItemType);
+        static constexpr size_t MIN_SLAB_SIZE = 8;
+        static constexpr size_t MAX_SLAB_SIZE = 256;
+
+        // Блоки, на которые ссылается список, упорядочены по адресу.
+        // Служебные данные, как и в MemoryResource, хранятся вне арены
+        std::vector<SlabHeader*> _slabs;
+
+        SlabHeader* _openSlab;
+        ItemType* _openCursor;
+        ItemType* _openEnd;
+        size_t _nextSlabSize;
+
+        static ItemType* itemsOf(SlabHeader* header) {
+            return reinterpret_cast<ItemType*>(header) + HEADER_ITEMS;
+        }
+
+        typename std::vector<SlabHeader*>::iterator findSlot(SlabHeader* header) {
+            return std::lower_bound(this->_slabs.begin(), this->_slabs.end(), header, std::less<SlabHeader*>{});
+        }
+
+        SlabHeader* createSlab(AllocatorType& alloc, size_t capacity) {
+            ItemType* rawPtr = Traits::allocate(alloc, HEADER_ITEMS + capacity);
+            SlabHeader* header = ::new (static_cast<void*>(rawPtr)) SlabHeader{capacity, 0, 1};
+
+            try {
+                this->_slabs.insert(this->findSlot(header), header);
+            } catch (...) {
+                Traits::deallocate(alloc, rawPtr, HEADER_ITEMS + capacity);
+                throw;
+            }
+
+            return header;
+        }
+
+        void freeSlab(AllocatorType& alloc, SlabHeader* header) {
+            size_t capacity = header->capacity;
+            header->~SlabHeader();
+            Traits::deallocate(alloc, reinterpret_cast<ItemType*>(header), HEADER_ITEMS + capacity);
+        }
+
+        // Список перестаёт ссылаться на блок
+        void dropSlab(AllocatorType& alloc, SlabHeader* header) {
+            this->_slabs.erase(this->findSlot(header));
+
+            if (header == this->_openSlab) {
+                this->_openSlab = nullptr;
+                this->_openCursor = nullptr;
+                this->_openEnd = nullptr;
+            }
+
+            // Опустевший список снова начинает с маленьких блоков: иначе при
+            // чередовании вставок и удалений блоки росли бы без предела
+            if (this->_slabs.empty()) {
+                this->_nextSlabSize = MIN_SLAB_SIZE;
+            }
+
+            if (--header->owners == 0 && header->live == 0) {
+                this->freeSlab(alloc, header);
+            }
+        }
+
+        SlabHeader* findOwner(ItemType* item) {
+            auto slabIt = std::upper_bound(
+                this->_slabs.begin(), this->_slabs.end(), item,
+                [](ItemType* ptr, SlabHeader* header) {
+                    return std::less<const void*>{}(ptr, header);
+                }
+            );
+
+            if (slabIt != this->_slabs.begin()) {
+                SlabHeader* header = *(slabIt - 1);
+                ItemType* items = itemsOf(header);
+
+                if (!std::less<ItemType*>{}(item, items) && std::less<ItemType*>{}(item, items + header->capacity)) {
+                    return header;
+                }
+            }
+
+            throw std::logic_error("Node does not belong to the list storage");
+        }
+
+    public:
+        static constexpr size_t INLINE_CAPACITY = 0;
+
+        explicit Storage(const AllocatorType&) :
+            _slabs(), _openSlab(nullptr), _openCursor(nullptr), _openEnd(nullptr),
+            _nextSlabSize(MIN_SLAB_SIZE) {}
+
+        Storage(Storage&& other) noexcept :
+            _slabs(std::move(other._slabs)), _openSlab(other._openSlab), _openCursor(other._openCursor),
+            _openEnd(other._openEnd), _nextSlabSize(other._nextSlabSize) {
+            other._slabs.clear();
+            other._openSlab = nullptr;
+            other._openCursor = nullptr;
+            other._openEnd = nullptr;
+            other._nextSlabSize = MIN_SLAB_SIZE;
+        }
+
+        Storage(const Storage&) = delete;
+
+        ItemType* acquire(AllocatorType& alloc) {
+            if (this->_openCursor == this->_openEnd) {
+                this->_openSlab = this->createSlab(alloc, this->_nextSlabSize);
+                this->_openCursor = itemsOf(this->_openSlab);
+                this->_openEnd = this->_openCursor + this->_openSlab->capacity;
+                this->_nextSlabSize = std::min(this->_nextSlabSize * 2, MAX_SLAB_SIZE);
+            }
+
+            ++this->_openSlab->live;
+            return this->_openCursor++;
+        }
+
+        // Узлы пакета учитываются как живые по мере вызова callback,
+        // поэтому при исключении достаточно вернуть уже выданные узлы
+        template <typename Callback>
+        void acquireBatch(AllocatorType& alloc, size_t count, Callback&& onItem) {
+            if (count == 0) {
+                return;
+            }
+
+            SlabHeader* header = this->createSlab(alloc, count);
+            ItemType* items = itemsOf(header);
+
+            for (size_t i = 0; i < count; ++i) {
+                ++header->live;
+                onItem(items + i);
+            }
+        }
+
+        void release(AllocatorType& alloc, ItemType* item) {
+            SlabHeader* header = this->findOwner(item);
+
+            if (--header->live == 0) {
+                this->dropSlab(alloc, header);
+            }
+        }
+
+        // Блок возвращается аллокатору сам, когда в нём не остаётся живых узлов
+        void releaseBatch(AllocatorType& alloc, void** items, size_t count) {
+            for (size_t i = 0; i < count; ++i) {
+                this->release(alloc, static_cast<ItemType*>(items[i]));
+            }
+        }
+
+        // Узлы other теперь могут оказаться в нашем списке - начинаем ссылаться на его блоки
+        void adopt(Storage& other) {
+            if (&other == this) {
+                return;
+            }
+
+            for (SlabHeader* header : other._slabs) {
+                auto slot = this->findSlot(header);
+
+                if (slot == this->_slabs.end() || *slot != header) {
+                    this->_slabs.insert(slot, header);
+                    ++header->owners;
+                }
+            }
+        }
+
+        // Если ни один блок не разделён с другим списком, все узлы списка лежат
+        // только в его блоках, и блоки можно вернуть аллокатору целиком
+        bool releaseWholesale(AllocatorType& alloc) {
+            for (SlabHeader* header : this->_slabs) {
+                if (header->owners != 1) {
+                    return false;
+                }
+            }
+
+            for (SlabHeader* header : this->_slabs) {
+                this->freeSlab(alloc, header);
+            }
+
+            this->_slabs.clear();
+            this->_openSlab = nullptr;
+            this->_openCursor = nullptr;
+            this->_openEnd = nullptr;
+            this->_nextSlabSize = MIN_SLAB_SIZE;
+
+            return true;
+        }
+
+        void releaseAll(AllocatorType& alloc) {
+            while (!this->_slabs.empty()) {
+                this->dropSlab(alloc, this->_slabs.back());
+            }
+
+            this->_nextSlabSize = MIN_SLAB_SIZE;
+        }
+    };
+};
+
+// Первые N узлов размещаются во встроенном буфере самого списка, без вызовов
+// аллокатора; остальные выделяются политикой FallbackPolicy.
+// Освободившиеся ячейки буфера используются повторно раньше аллокатора.
+// Маленькие списки (до N элементов) не обращаются к аллокатору вовсе
+template <size_t N, typename FallbackPolicy = PerNodeAllocation>
+struct InlineAllocation {
+    static_assert(N > 0, "Inline capacity must be positive");
+
+    template <typename ItemType, typename AllocatorType>
+    class Storage {
+    private:
+        using FallbackStorage = typename FallbackPolicy::template Storage<ItemType, AllocatorType>;
+
+        alignas(ItemType) std::byte _buffer[N * sizeof(ItemType)];
+
+        // Стек свободных ячеек буфера, вершина - _freeSlots[_freeCount - 1]
+        std::array<size_t, N> _freeSlots;
+        size_t _freeCount;
+
+        FallbackStorage _fallback;
+
+        ItemType* slotItem(size_t slot) {
+            return reinterpret_cast<ItemType*>(this->_buffer + slot * sizeof(ItemType));
+        }
+
+        // Ячейки выдаются по порядку адресов: 0, 1, 2, ...
+        void resetSlots() {
+            for (size_t i = 0; i < N; ++i) {
+                this->_freeSlots[i] = N - 1 - i;
+            }
+            this->_freeCount = N;
+        }
+
+    public:
+        static constexpr size_t INLINE_CAPACITY = N;
+
+        explicit Storage(const AllocatorType& alloc) : _fallback(alloc) {
+            this->resetSlots();
+        }
+
+        // Встроенные узлы остаются в other: список переносит их значения сам
+        Storage(Storage&& other) noexcept : _fallback(std::move(other._fallback)) {
+            this->resetSlots();
+        }
+
+        Storage(const Storage&) = delete;
+
+        size_t inlineItems() const {
+            return N - this->_freeCount;
+        }
+
+        bool isInline(const ItemType* item) const {
+            const std::byte* ptr = reinterpret_cast<const std::byte*>(item);
+
+            return !std::less<const std::byte*>{}(ptr, this->_buffer) &&
+                std::less<const std::byte*>{}(ptr, this->_buffer + sizeof(this->_buffer));
+        }
+
+        ItemType* acquire(AllocatorType& alloc) {
+            if (this->_freeCount > 0) {
+                return this->slotItem(this->_freeSlots[--this->_freeCount]);
+            }
+
+            return this->_fallback.acquire(alloc);
+        }
+
+        template <typename Callback>
+        void acquireBatch(AllocatorType& alloc, size_t count, Callback&& onItem) {
+            size_t inlineCount = std::min(count, this->_freeCount);
+
+            for (size_t i = 0; i < inlineCount; ++i) {
+                onItem(this->slotItem(this->_freeSlots[--this->_freeCount]));
+            }
+
+            this->_fallback.acquireBatch(alloc, count - inlineCount, onItem);
+        }
+
+        void release(AllocatorType& alloc, ItemType* item) {
+            if (this->isInline(item)) {
+                size_t slot = static_cast<size_t>(reinterpret_cast<std::byte*>(item) - this->_buffer) / sizeof(ItemType);
+                this->_freeSlots[this->_freeCount++] = slot;
+                return;
+            }
+
+            this->_fallback.release(alloc, item);
+        }
+
+        // Встроенные узлы возвращаются в буфер, остальные - пакетом в FallbackPolicy
+        void releaseBatch(AllocatorType& alloc, void** items, size_t count) {
+            size_t fallbackCount = 0;
+
+            for (size_t i = 0; i < count; ++i) {
+                ItemType* item = static_cast<ItemType*>(items[i]);
+
+                if (this->isInline(item)) {
+                    this->release(alloc, item);
+                } else {
+                    items[fallbackCount++] = item;
+                }
+            }
+
+            this->_fallback.releaseBatch(alloc, items, fallbackCount);
+        }
+
+        void adopt(Storage& other) {
+            if (&other != this) {
+                this->_fallback.adopt(other._fallback);
+            }
+        }
+
+        bool releaseWholesale(AllocatorType& alloc) {
+            if (!this->_fallback.releaseWholesale(alloc)) {
+                return false;
+            }
+
+            this->resetSlots();
+            return true;
+        }
+
+        void releaseAll(AllocatorType& alloc) {
+            this->_fallback.releaseAll(alloc);
+        }
+    };
+};
+
+// Освобождённые узлы не возвращаются аллокатору, а складываются в кэш списка
+// (не больше Cap узлов) и выдаются повторно. При работе в режиме очереди
+// с устойчивым размером вставки и удаления не обращаются к аллокатору.
+// reserve(count) пополняет кэш одним пакетом FallbackPolicy (при SlabAllocation -
+// одним вызовом аллокатора) и поднимает предел кэша до count
+template <size_t Cap, typename FallbackPolicy = SlabAllocation>
+struct RecyclingAllocation {
+    template <typename ItemType, typename AllocatorType>
+    class Storage {
+    private:
+        using FallbackStorage = typename FallbackPolicy::template Storage<ItemType, AllocatorType>;
+
+        // Узел кэша: ссылка на следующий размещается в памяти свободного узла
+        struct FreeItem {
+            FreeItem* next;
+        };
+
+        static_assert(sizeof(ItemType) >= sizeof(FreeItem) && alignof(ItemType) >= alignof(FreeItem));
+
+        FreeItem* _freeHead;
+        size_t _freeCount;
+        size_t _cacheLimit;
+
+        FallbackStorage _fallback;
+
+        void pushFree(ItemType* item) {
+            this->_freeHead = ::new (static_cast<void*>(item)) FreeItem{this->_freeHead};
+            ++this->_freeCount;
+        }
+
+        ItemType* popFree() {
+            FreeItem* item = this->_freeHead;
+            this->_freeHead = item->next;
+            --this->_freeCount;
+
+            item->~FreeItem();
+            return reinterpret_cast<ItemType*>(item);
+        }
+
+        void releaseCache(AllocatorType& alloc) {
+            while (this->_freeCount > 0) {
+                this->_fallback.release(alloc, this->popFree());
+            }
+        }
+
+    public:
+        static constexpr size_t INLINE_CAPACITY = 0;
+
+        explicit Storage(const AllocatorType& alloc) :
+            _freeHead(nullptr), _freeCount(0), _cacheLimit(Cap), _fallback(alloc) {}
+
+        Storage(Storage&& other) noexcept :
+            _freeHead(other._freeHead), _freeCount(other._freeCount), _cacheLimit(other._cacheLimit),
+            _fallback(std::move(other._fallback)) {
+            other._freeHead = nullptr;
+            other._freeCount = 0;
+            other._cacheLimit = Cap;
+        }
+
+        Storage(const Storage&) = delete;
+
+        size_t cachedItems() const {
+            return this->_freeCount;
+        }
+
+        void reserve(AllocatorType& alloc, size_t count) {
+            this->_cacheLimit = std::max(this->_cacheLimit, count);
+
+            if (count > this->_freeCount) {
+                this->_fallback.acquireBatch(alloc, count - this->_freeCount, [this](ItemType* item) {
+                    this->pushFree(item);
+                });
+            }
+        }
+
+        ItemType* acquire(AllocatorType& alloc) {
+            if (this->_freeCount > 0) {
+                return this->popFree();
+            }
+
+            return this->_fallback.acquire(alloc);
+        }
+
+        template <typename Callback>
+        void acquireBatch(AllocatorType& alloc, size_t count, Callback&& onItem) {
+            size_t cachedCount = std::min(count, this->_freeCount);
+
+            for (size_t i = 0; i < cachedCount; ++i) {
+                onItem(this->popFree());
+            }
+
+            this->_fallback.acquireBatch(alloc, count - cachedCount, onItem);
+        }
+
+        void release(AllocatorType& alloc, ItemType* item) {
+            if (this->_freeCount < this->_cacheLimit) {
+                this->pushFree(item);
+                return;
+            }
+
+            this->_fallback.release(alloc, item);
+        }
+
+        // В кэш уходит сколько поместится, остальное - пакетом в FallbackPolicy
+        void releaseBatch(AllocatorType& alloc, void** items, size_t count) {
+            size_t cachedCount = std::min(count, this->_cacheLimit - std::min(this->_cacheLimit, this->_freeCount));
+
+            for (size_t i = 0; i < cachedCount; ++i) {
+                this->pushFree(static_cast<ItemType*>(items[i]));
+            }
+
+            this->_fallback.releaseBatch(alloc, items + cachedCount, count - cachedCount);
+        }
+
+        void adopt(Storage& other) {
+            if (&other != this) {
+                this->_fallback.adopt(other._fallback);
+            }
+        }
+
+        // Узлы кэша освобождаются вместе с остальными узлами
+        bool releaseWholesale(AllocatorType& alloc) {
+            if (!this->_fallback.releaseWholesale(alloc)) {
+                return false;
+            }
+
+            this->_freeHead = nullptr;
+            this->_freeCount = 0;
+            return true;
+        }
+
+        // Кэш освобождается, узлы списка остаются
+        void shrink(AllocatorType& alloc) {
+            this->releaseCache(alloc);
+            this->_cacheLimit = Cap;
+        }
+
+        void releaseAll(AllocatorType& alloc) {
+            this->shrink(alloc);
+            this->_fallback.releaseAll(alloc);
+        }
+    };
+};
@@ -0,0 +1,144 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "ThreadPool.hpp"
+
+// Параллельные алгоритмы над LinkedList.
+// Список делится на сегменты одним проходом по цепочке: запоминаются
+// итераторы на начало каждого сегмента. Сегменты обрабатываются задачами
+// пула с кражей работы, поэтому неравномерная стоимость элементов и
+// разбросанные по памяти узлы не блокируют остальные потоки.
+// Разбиение можно построить один раз и переиспользовать, пока список не меняется.
+
+template <typename Iterator>
+struct ListSegment {
+    Iterator first;
+    size_t length;
+};
+
+template <typename ListType>
+using ListSegments = std::vector<ListSegment<typename ListType::iterator>>;
+
+// Разбиение списка на segmentCount сегментов примерно равной длины за один проход
+template <typename ListType>
+ListSegments<ListType> makeSegments(ListType& list, size_t segmentCount) {
+    ListSegments<ListType> segments;
+    size_t listSize = list.getSize();
+
+    if (listSize == 0) {
+        return segments;
+    }
+
+    segmentCount = std::max<size_t>(1, std::min(segmentCount, listSize));
+    size_t baseLength = listSize / segmentCount;
+    size_t extraItems = listSize % segmentCount;
+
+    segments.reserve(segmentCount);
+    auto it = list.begin();
+
+    for (size_t segmentIdx = 0; segmentIdx < segmentCount; ++segmentIdx) {
+        size_t length = baseLength + (segmentIdx < extraItems ? 1 : 0);
+        segments.push_back({it, length});
+
+        if (segmentIdx + 1 < segmentCount) {
+            for (size_t i = 0; i < length; ++i) {
+                ++it;
+            }
+        }
+    }
+
+    return segments;
+}
+
+// Число сегментов по умолчанию: с запасом на кражу работы
+inline size_t defaultSegmentCount(const ThreadPool& pool) {
+    return (pool.getThreadCount() + 1) * 4;
+}
+
+// func(value) для каждого элемента
+template <typename Iterator, typename Func>
+void parallelForEach(std::vector<ListSegment<Iterator>>& segments, Func func, ThreadPool& pool) {
+    std::vector<std::function<void()>> tasks;
+    tasks.reserve(segments.size());
+
+    for (auto& segment : segments) {
+        tasks.push_back([&segment, &func]() {
+            auto it = segment.first;
+            for (size_t i = 0; i < segment.length; ++i, ++it) {
+                func(*it);
+            }
+        });
+    }
+
+    pool.runAndWait(tasks);
+}
+
+template <typename ListType, typename Func>
+void parallelForEach(ListType& list, Func func, ThreadPool& pool) {
+    ListSegments<ListType> segments = makeSegments(list, defaultSegmentCount(pool));
+    parallelForEach(segments, std::move(func), pool);
+}
+
+// Замена каждого элемента на op(value)
+template <typename Iterator, typename UnaryOp>
+void parallelTransform(std::vector<ListSegment<Iterator>>& segments, UnaryOp op, ThreadPool& pool) {
+    parallelForEach(segments, [&op](typename Iterator::value_type& value) {
+        value = op(value);
+    }, pool);
+}
+
+template <typename ListType, typename UnaryOp>
+void parallelTransform(ListType& list, UnaryOp op, ThreadPool& pool) {
+    ListSegments<ListType> segments = makeSegments(list, defaultSegmentCount(pool));
+    parallelTransform(segments, std::move(op), pool);
+}
+
+// Свёртка reduceOp(..., project(value)) начиная с init.
+// Частичные результаты сегментов объединяются в порядке сегментов,
+// поэтому для ассоциативной reduceOp результат детерминирован
+template <typename Iterator, typename ResultType, typename ReduceOp, typename Projection>
+ResultType parallelReduce(std::vector<ListSegment<Iterator>>& segments, ResultType init, ReduceOp reduceOp, Projection project, ThreadPool& pool) {
+    std::vector<ResultType> partials(segments.size(), ResultType{});
+    std::vector<std::function<void()>> tasks;
+    tasks.reserve(segments.size());
+
+    for (size_t segmentIdx = 0; segmentIdx < segments.size(); ++segmentIdx) {
+        tasks.push_back([&segments, &partials, &reduceOp, &project, segmentIdx]() {
+            auto it = segments[segmentIdx].first;
+            ResultType partial = project(*it);
+
+            ++it;
+            for (size_t i = 1; i < segments[segmentIdx].length; ++i, ++it) {
+                partial = reduceOp(std::move(partial), project(*it));
+            }
+
+            partials[segmentIdx] = std::move(partial);
+        });
+    }
+
+    pool.runAndWait(tasks);
+
+    for (auto& partial : partials) {
+        init = reduceOp(std::move(init), std::move(partial));
+    }
+
+    return init;
+}
+
+template <typename ListType, typename ResultType, typename ReduceOp, typename Projection>
+ResultType parallelReduce(ListType& list, ResultType init, ReduceOp reduceOp, Projection project, ThreadPool& pool) {
+    ListSegments<ListType> segments = makeSegments(list, defaultSegmentCount(pool));
+    return parallelReduce(segments, std::move(init), std::move(reduceOp), std::move(project), pool);
+}
+
+template <typename ListType, typename ResultType, typename ReduceOp>
+ResultType parallelReduce(ListType& list, ResultType init, ReduceOp reduceOp, ThreadPool& pool) {
+    return parallelReduce(list, std::move(init), std::move(reduceOp), [](const typename ListType::elementType& value) {
+        return value;
+    }, pool);
+}
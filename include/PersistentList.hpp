@@ -0,0 +1,216 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
+#include <utility>
+
+// Неизменяемый односвязный список со структурным разделением.
+// pushFront и popFront не меняют список, а возвращают новую версию,
+// которая разделяет с исходной общий хвост, поэтому снимок (копия
+// PersistentList) стоит O(1) по времени и памяти.
+//
+// Узлы считают ссылки атомарно: версии можно передавать в другие потоки
+// и читать без блокировок. Как и shared_ptr, один и тот же объект
+// PersistentList нельзя одновременно менять и читать из разных потоков -
+// каждый поток работает со своей копией.
+// Последняя ссылка на узел может исчезнуть в любом потоке, поэтому
+// memory_resource должен быть потокобезопасным.
+template <typename T>
+class PersistentList {
+private:
+    struct PersistentListItem {
+        mutable std::atomic<size_t> refCount;
+        const PersistentListItem* nextItem;
+        T value;
+
+        template <typename... Args>
+        PersistentListItem(const PersistentListItem* next, Args&&... args) :
+            refCount(1), nextItem(next), value(std::forward<Args>(args)...) {}
+    };
+
+    using AllocatorType = std::pmr::polymorphic_allocator<PersistentListItem>;
+
+    const PersistentListItem* _head;
+    size_t _listSize;
+
+    // Хранится ресурс, а не аллокатор: polymorphic_allocator нельзя присваивать,
+    // а версии должны свободно присваиваться друг другу
+    std::pmr::memory_resource* _resource;
+
+    PersistentList(const PersistentListItem* head, size_t listSize, std::pmr::memory_resource* resource) :
+        _head(head), _listSize(listSize), _resource(resource) {}
+
+    static void retain(const PersistentListItem* item) {
+        if (item != nullptr) {
+            item->refCount.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    // Освобождение цепочки без рекурсии: идём дальше, пока узел никому не нужен
+    void release(const PersistentListItem* item) const {
+        AllocatorType alloc(this->_resource);
+
+        while (item != nullptr && item->refCount.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            const PersistentListItem* nextItem = item->nextItem;
+            PersistentListItem* ownedItem = const_cast<PersistentListItem*>(item);
+
+            std::allocator_traits<AllocatorType>::destroy(alloc, ownedItem);
+            alloc.deallocate(ownedItem, 1);
+
+            item = nextItem;
+        }
+    }
+
+    // Новый узел перед next, ссылка на next переходит к узлу
+    template <typename... Args>
+    const PersistentListItem* createItem(const PersistentListItem* next, Args&&... args) const {
+        AllocatorType alloc(this->_resource);
+        PersistentListItem* item = alloc.allocate(1);
+
+        try {
+            std::allocator_traits<AllocatorType>::construct(alloc, item, next, std::forward<Args>(args)...);
+        } catch (...) {
+            alloc.deallocate(item, 1);
+            throw;
+        }
+
+        return item;
+    }
+
+public:
+    class iterator {
+    private:
+        const PersistentListItem* _item;
+
+    public:
+        using value_type = T;
+        using reference = const T&;
+        using pointer = const T*;
+        using difference_type = std::ptrdiff_t;
+        using iterator_category = std::forward_iterator_tag;
+
+        iterator(const PersistentListItem* item = nullptr) : _item(item) {}
+
+        reference operator*() const {
+            if (this->_item == nullptr) {
+                throw std::out_of_range("List index is out of range!");
+            }
+
+            return this->_item->value;
+        }
+
+        iterator& operator++() {
+            if (this->_item != nullptr) {
+                this->_item = this->_item->nextItem;
+            }
+
+            return *this;
+        }
+
+        iterator operator++(int) {
+            iterator temp(*this);
+            ++(*this);
+            return temp;
+        }
+
+        bool operator==(const iterator& other) const {
+            return this->_item == other._item;
+        }
+
+        bool operator!=(const iterator& other) const {
+            return !(*this == other);
+        }
+    };
+
+    using elementType = T;
+
+    PersistentList(std::pmr::polymorphic_allocator<T> alloc = {}) : _head(nullptr), _listSize(0), _resource(alloc.resource()) {}
+
+    PersistentList(std::initializer_list<T> params, std::pmr::polymorphic_allocator<T> alloc = {}) : PersistentList(alloc) {
+        // Строим с конца, чтобы каждый узел ссылался на уже готовый хвост
+        for (auto it = std::rbegin(params); it != std::rend(params); ++it) {
+            this->_head = this->createItem(this->_head, *it);
+            ++this->_listSize;
+        }
+    }
+
+    // Снимок: O(1), новых узлов не создаётся
+    PersistentList(const PersistentList& other) :
+        _head(other._head), _listSize(other._listSize), _resource(other._resource) {
+        retain(this->_head);
+    }
+
+    PersistentList(PersistentList&& other) noexcept :
+        _head(other._head), _listSize(other._listSize), _resource(other._resource) {
+        other._head = nullptr;
+        other._listSize = 0;
+    }
+
+    PersistentList& operator=(PersistentList other) noexcept {
+        std::swap(this->_head, other._head);
+        std::swap(this->_listSize, other._listSize);
+        std::swap(this->_resource, other._resource);
+
+        return *this;
+    }
+
+    ~PersistentList() {
+        this->release(this->_head);
+    }
+
+    // Новая версия с value в начале, хвост общий с текущей
+    PersistentList pushFront(const T& value) const {
+        return this->emplaceFront(value);
+    }
+
+    template <typename... Args>
+    PersistentList emplaceFront(Args&&... args) const {
+        retain(this->_head);
+
+        try {
+            return PersistentList(this->createItem(this->_head, std::forward<Args>(args)...), this->_listSize + 1, this->_resource);
+        } catch (...) {
+            this->release(this->_head);
+            throw;
+        }
+    }
+
+    // Новая версия без первого элемента, O(1)
+    PersistentList popFront() const {
+        if (this->_listSize == 0) {
+            throw std::out_of_range("Cannot pop from empty list!");
+        }
+
+        retain(this->_head->nextItem);
+        return PersistentList(this->_head->nextItem, this->_listSize - 1, this->_resource);
+    }
+
+    const T& front() const {
+        if (this->_listSize == 0) {
+            throw std::out_of_range("List index is out of range!");
+        }
+
+        return this->_head->value;
+    }
+
+    size_t getSize() const {
+        return this->_listSize;
+    }
+
+    bool isEmpty() const {
+        return this->_listSize == 0;
+    }
+
+    iterator begin() const {
+        return iterator(this->_head);
+    }
+
+    iterator end() const {
+        return iterator(nullptr);
+    }
+};
@@ -0,0 +1,137 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+// Пул блоков фиксированных размеров без виртуальных вызовов.
+// Запросы до MAX_POOLED_SIZE байт округляются до SIZE_STEP и обслуживаются
+// из списка свободных блоков своего класса размера, а при его пустоте -
+// сдвигом указателя в текущем куске памяти. Более крупные запросы уходят в
+// operator new. Вся реализация в заголовке, чтобы компилятор мог встроить
+// выделение в вызывающий код. Пул не потокобезопасен.
+class NodePool {
+private:
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    static constexpr size_t CHUNK_SIZE = 64 * 1024;
+    static constexpr size_t SIZE_CLASSES = 32;
+
+    FreeBlock* _freeLists[SIZE_CLASSES];
+    char* _chunkCursor;
+    char* _chunkEnd;
+    std::vector<void*> _chunks;
+
+    static size_t sizeClassOf(size_t bytes) {
+        return (bytes + SIZE_STEP - 1) / SIZE_STEP - 1;
+    }
+
+    void* carveBlock(size_t blockSize) {
+        if (static_cast<size_t>(this->_chunkEnd - this->_chunkCursor) < blockSize) {
+            void* chunk = ::operator new(CHUNK_SIZE, std::align_val_t(ALIGNMENT));
+            this->_chunks.push_back(chunk);
+
+            this->_chunkCursor = static_cast<char*>(chunk);
+            this->_chunkEnd = this->_chunkCursor + CHUNK_SIZE;
+        }
+
+        void* block = this->_chunkCursor;
+        this->_chunkCursor += blockSize;
+
+        return block;
+    }
+
+public:
+    static constexpr size_t SIZE_STEP = 8;
+    static constexpr size_t ALIGNMENT = 8;
+    static constexpr size_t MAX_POOLED_SIZE = SIZE_STEP * SIZE_CLASSES;
+
+    NodePool() : _freeLists{}, _chunkCursor(nullptr), _chunkEnd(nullptr) {}
+
+    NodePool(const NodePool&) = delete;
+    NodePool& operator=(const NodePool&) = delete;
+
+    ~NodePool() {
+        for (void* chunk : this->_chunks) {
+            ::operator delete(chunk, std::align_val_t(ALIGNMENT));
+        }
+    }
+
+    void* allocate(size_t bytes) {
+        if (bytes == 0 || bytes > MAX_POOLED_SIZE) {
+            return ::operator new(bytes, std::align_val_t(ALIGNMENT));
+        }
+
+        size_t sizeClass = sizeClassOf(bytes);
+        FreeBlock* block = this->_freeLists[sizeClass];
+
+        if (block != nullptr) {
+            this->_freeLists[sizeClass] = block->next;
+            return block;
+        }
+
+        return this->carveBlock((sizeClass + 1) * SIZE_STEP);
+    }
+
+    void deallocate(void* ptr, size_t bytes) {
+        if (bytes == 0 || bytes > MAX_POOLED_SIZE) {
+            ::operator delete(ptr, std::align_val_t(ALIGNMENT));
+            return;
+        }
+
+        size_t sizeClass = sizeClassOf(bytes);
+        FreeBlock* block = static_cast<FreeBlock*>(ptr);
+
+        block->next = this->_freeLists[sizeClass];
+        this->_freeLists[sizeClass] = block;
+    }
+};
+
+// Стандартный аллокатор поверх NodePool со статической диспетчеризацией
+template <typename T>
+class PoolAllocator {
+private:
+    template <typename U>
+    friend class PoolAllocator;
+
+    NodePool* _pool;
+
+public:
+    using value_type = T;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+    using is_always_equal = std::false_type;
+
+    explicit PoolAllocator(NodePool* pool) noexcept : _pool(pool) {}
+
+    template <typename U>
+    PoolAllocator(const PoolAllocator<U>& other) noexcept : _pool(other._pool) {}
+
+    T* allocate(size_t count) {
+        if constexpr (alignof(T) > NodePool::ALIGNMENT) {
+            return static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t(alignof(T))));
+        } else {
+            return static_cast<T*>(this->_pool->allocate(count * sizeof(T)));
+        }
+    }
+
+    void deallocate(T* ptr, size_t count) {
+        if constexpr (alignof(T) > NodePool::ALIGNMENT) {
+            ::operator delete(ptr, std::align_val_t(alignof(T)));
+        } else {
+            this->_pool->deallocate(ptr, count * sizeof(T));
+        }
+    }
+
+    NodePool* pool() const noexcept {
+        return this->_pool;
+    }
+
+    template <typename U>
+    bool operator==(const PoolAllocator<U>& other) const noexcept {
+        return this->_pool == other._pool;
+    }
+};
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Пул потоков с очередью задач на каждый поток и кражей работы:
+// поток берёт задачи из начала своей очереди, а опустевший поток
+// забирает задачи с конца чужих очередей
+class ThreadPool {
+private:
+    struct WorkerQueue {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    std::vector<std::unique_ptr<WorkerQueue>> _queues;
+    std::vector<std::thread> _workers;
+
+    std::mutex _wakeMutex;
+    std::condition_variable _wakeCondition;
+    std::atomic<size_t> _pendingTasks;
+    std::atomic<size_t> _nextQueue;
+    bool _stopping;
+
+    bool tryRunTask(size_t preferredQueue);
+    void workerLoop(size_t queueIdx);
+
+    // Постановка задачи в очередь; задача не должна бросать исключений -
+    // их перехватывают обёртки submit и runAndWait
+    void enqueue(std::function<void()> task);
+
+public:
+    // threadCount == 0 - по числу аппаратных потоков
+    explicit ThreadPool(size_t threadCount = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // Исключение задачи не выходит в поток пула, а передаётся в future
+    std::future<void> submit(std::function<void()> task);
+
+    // Выполнение пакета задач с ожиданием завершения. Вызывающий поток
+    // тоже выполняет задачи; первое исключение из задач пробрасывается
+    void runAndWait(std::vector<std::function<void()>>& tasks);
+
+    size_t getThreadCount() const;
+};
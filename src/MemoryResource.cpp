@@ -1,6 +1,7 @@
 #include "../include/MemoryResource.hpp"
 #include <algorithm>
 #include <cstddef>
+#include <functional>
 #include <new>
 #include <stdexcept>
 
@@ -53,6 +54,33 @@ void MemoryResource::do_deallocate(void *ptr, size_t deallocationSize, size_t al
     throw std::logic_error("Attempt to deallocate unallocated memory");
 }
 
+// Адреса сортируются и сопоставляются с упорядоченным списком блоков
+// за один проход. Если хотя бы один адрес не выделен, ничего не освобождается
+void MemoryResource::do_deallocate_batch(void** ptrs, size_t count, size_t deallocationSize, size_t alignment) {
+    std::sort(ptrs, ptrs + count, std::less<void*>{});
+
+    size_t matched = 0;
+    for (auto blockIt = this->_usedMemBlocks.begin(); blockIt != this->_usedMemBlocks.end() && matched < count; ++blockIt) {
+        if (ptrs[matched] == this->_memBuffer + blockIt->memOffset) {
+            ++matched;
+        }
+    }
+
+    if (matched != count) {
+        throw std::logic_error("Attempt to deallocate unallocated memory");
+    }
+
+    size_t ptrIdx = 0;
+    for (auto blockIt = this->_usedMemBlocks.begin(); blockIt != this->_usedMemBlocks.end() && ptrIdx < count;) {
+        if (ptrs[ptrIdx] == this->_memBuffer + blockIt->memOffset) {
+            blockIt = this->_usedMemBlocks.erase(blockIt);
+            ++ptrIdx;
+        } else {
+            ++blockIt;
+        }
+    }
+}
+
 bool MemoryResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
     return this == &other;
 }
\ No newline at end of file
@@ -0,0 +1,148 @@
+#include "../include/ThreadPool.hpp"
+#include <algorithm>
+#include <exception>
+#include <memory>
+
+ThreadPool::ThreadPool(size_t threadCount) : _pendingTasks(0), _nextQueue(0), _stopping(false) {
+    if (threadCount == 0) {
+        threadCount = std::max<size_t>(1, std::thread::hardware_concurrency());
+    }
+
+    for (size_t i = 0; i < threadCount; ++i) {
+        this->_queues.push_back(std::make_unique<WorkerQueue>());
+    }
+
+    for (size_t i = 0; i < threadCount; ++i) {
+        this->_workers.emplace_back(&ThreadPool::workerLoop, this, i);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(this->_wakeMutex);
+        this->_stopping = true;
+    }
+    this->_wakeCondition.notify_all();
+
+    for (auto& worker : this->_workers) {
+        worker.join();
+    }
+}
+
+bool ThreadPool::tryRunTask(size_t preferredQueue) {
+    std::function<void()> task;
+    size_t queueCount = this->_queues.size();
+
+    for (size_t i = 0; i < queueCount && !task; ++i) {
+        WorkerQueue& queue = *this->_queues[(preferredQueue + i) % queueCount];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+
+        if (queue.tasks.empty()) {
+            continue;
+        }
+
+        // Из своей очереди берём с начала, из чужой - крадём с конца
+        if (i == 0) {
+            task = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+        } else {
+            task = std::move(queue.tasks.back());
+            queue.tasks.pop_back();
+        }
+    }
+
+    if (!task) {
+        return false;
+    }
+
+    --this->_pendingTasks;
+    task();
+
+    return true;
+}
+
+void ThreadPool::workerLoop(size_t queueIdx) {
+    while (true) {
+        if (this->tryRunTask(queueIdx)) {
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(this->_wakeMutex);
+        this->_wakeCondition.wait(lock, [this]() {
+            return this->_stopping || this->_pendingTasks.load() > 0;
+        });
+
+        if (this->_stopping && this->_pendingTasks.load() == 0) {
+            return;
+        }
+    }
+}
+
+void ThreadPool::enqueue(std::function<void()> task) {
+    size_t queueIdx = this->_nextQueue.fetch_add(1) % this->_queues.size();
+
+    // Счётчик увеличивается до публикации задачи, чтобы он не уходил в минус
+    {
+        std::lock_guard<std::mutex> lock(this->_wakeMutex);
+        ++this->_pendingTasks;
+    }
+
+    {
+        WorkerQueue& queue = *this->_queues[queueIdx];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.tasks.push_back(std::move(task));
+    }
+    this->_wakeCondition.notify_one();
+}
+
+std::future<void> ThreadPool::submit(std::function<void()> task) {
+    auto promise = std::make_shared<std::promise<void>>();
+    std::future<void> result = promise->get_future();
+
+    this->enqueue([task = std::move(task), promise]() {
+        try {
+            task();
+            promise->set_value();
+        } catch (...) {
+            promise->set_exception(std::current_exception());
+        }
+    });
+
+    return result;
+}
+
+void ThreadPool::runAndWait(std::vector<std::function<void()>>& tasks) {
+    std::atomic<size_t> remaining(tasks.size());
+    std::exception_ptr firstError;
+    std::mutex errorMutex;
+
+    for (auto& task : tasks) {
+        this->enqueue([&task, &remaining, &firstError, &errorMutex]() {
+            try {
+                task();
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(errorMutex);
+                if (!firstError) {
+                    firstError = std::current_exception();
+                }
+            }
+
+            --remaining;
+        });
+    }
+
+    size_t startQueue = this->_nextQueue.load();
+    while (remaining.load() > 0) {
+        if (!this->tryRunTask(startQueue++)) {
+            std::this_thread::yield();
+        }
+    }
+
+    if (firstError) {
+        std::rethrow_exception(firstError);
+    }
+}
+
+size_t ThreadPool::getThreadCount() const {
+    return this->_workers.size();
+}
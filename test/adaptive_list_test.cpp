@@ -0,0 +1,424 @@
+#include <gtest/gtest.h>
+#include "../include/AdaptiveList.hpp"
+#include "counting_resource.hpp"
+
+#include <iterator>
+#include <memory_resource>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Тесты списка с адаптивным представлением
+class AdaptiveListTest : public ::testing::Test {
+protected:
+    using IntList = AdaptiveList<int, std::allocator<ListItem<int>>>;
+    using StringList = AdaptiveList<std::string, std::pmr::polymorphic_allocator<ListItem<std::string>>>;
+
+    CountingResource countingRes;
+    std::pmr::polymorphic_allocator<ListItem<std::string>> stringAlloc{&countingRes};
+
+    template <typename ListType>
+    static auto values(ListType& list) {
+        std::vector<typename ListType::elementType> result;
+        for (const auto& value : list) {
+            result.push_back(value);
+        }
+        return result;
+    }
+};
+
+// ============ Кольцевое представление ============
+TEST_F(AdaptiveListTest, StartsContiguous) {
+    IntList list = {1, 2, 3};
+
+    EXPECT_TRUE(list.isContiguous());
+    EXPECT_EQ(list.getSize(), 3);
+    EXPECT_EQ(values(list), (std::vector<int>{1, 2, 3}));
+}
+
+TEST_F(AdaptiveListTest, EndOperationsStayContiguous) {
+    IntList list;
+
+    for (int i = 0; i < 100; ++i) {
+        list.pushBack(i);
+        list.pushFront(-i);
+    }
+    EXPECT_EQ(list.getSize(), 200);
+    EXPECT_EQ(list[0], -99);
+    EXPECT_EQ(list[199], 99);
+
+    for (int i = 0; i < 50; ++i) {
+        EXPECT_EQ(list.popFront(), -99 + i);
+        EXPECT_EQ(list.popBack(), 99 - i);
+    }
+
+    EXPECT_TRUE(list.isContiguous());
+    EXPECT_EQ(list.getSize(), 100);
+    EXPECT_EQ(list[0], -49);
+}
+
+// Голова кольца обходит конец буфера
+TEST_F(AdaptiveListTest, RingWrapsAround) {
+    IntList list = {0, 1, 2, 3, 4, 5, 6, 7};
+
+    for (int i = 8; i < 20; ++i) {
+        list.popFront();
+        list.pushBack(i);
+    }
+
+    EXPECT_EQ(values(list), (std::vector<int>{12, 13, 14, 15, 16, 17, 18, 19}));
+
+    std::vector<int> visited;
+    list.forEach([&visited](int value) { visited.push_back(value); });
+    EXPECT_EQ(visited, values(list));
+}
+
+TEST_F(AdaptiveListTest, PopFromEmptyThrows) {
+    IntList list;
+
+    EXPECT_THROW(list.popFront(), std::out_of_range);
+    EXPECT_THROW(list.popBack(), std::out_of_range);
+    EXPECT_THROW(list[0], std::out_of_range);
+}
+
+// Кольцо растёт вдвое: выделений O(log n), а не по одному на элемент
+TEST_F(AdaptiveListTest, RingAllocatesGeometrically) {
+    StringList list(stringAlloc);
+
+    for (int i = 0; i < 1000; ++i) {
+        list.emplaceBack(std::to_string(i));
+    }
+
+    EXPECT_TRUE(list.isContiguous());
+    EXPECT_LE(countingRes.allocations, 10);
+}
+
+TEST_F(AdaptiveListTest, RemoveIfKeepsRing) {
+    IntList list = {1, 2, 3, 4, 5, 6};
+
+    EXPECT_EQ(list.removeIf([](int value) { return value % 2 == 0; }), 3);
+    EXPECT_EQ(list.erase(5), 1);
+
+    EXPECT_TRUE(list.isContiguous());
+    EXPECT_EQ(values(list), (std::vector<int>{1, 3}));
+}
+
+// Исключение из предиката: удалённые до него элементы убраны, остальные на месте
+TEST_F(AdaptiveListTest, ThrowingPredicateKeepsRemainingElements) {
+    StringList list({"a", "b", "c", "d", "e", "f"}, stringAlloc);
+
+    int calls = 0;
+    EXPECT_THROW(list.removeIf([&calls](const std::string& value) {
+        if (++calls == 4) {
+            throw std::runtime_error("predicate failed");
+        }
+        return value == "a" || value == "c";
+    }), std::runtime_error);
+
+    EXPECT_TRUE(list.isContiguous());
+    EXPECT_EQ(values(list), (std::vector<std::string>{"b", "d", "e", "f"}));
+}
+
+// ============ Переход в связное представление ============
+TEST_F(AdaptiveListTest, InsertAfterConvertsToLinked) {
+    IntList list = {1, 2, 4};
+
+    auto it = list.insertAfter(std::next(list.begin()), 3);
+
+    EXPECT_FALSE(list.isContiguous());
+    EXPECT_EQ(*it, 3);
+    EXPECT_EQ(values(list), (std::vector<int>{1, 2, 3, 4}));
+
+    // Итератор, полученный после перехода, продолжает работать
+    it = list.insertAfter(it, 5);
+    EXPECT_EQ(*++it, 4);
+    EXPECT_EQ(values(list), (std::vector<int>{1, 2, 3, 5, 4}));
+}
+
+TEST_F(AdaptiveListTest, LinkedIteratorsCompareByNode) {
+    IntList list = {1, 3};
+    auto second = list.insertAfter(list.begin(), 2);
+
+    list.insertAfter(list.beforeBegin(), 0);
+
+    EXPECT_EQ(std::next(list.begin(), 2), second);
+    EXPECT_NE(std::next(list.begin()), second);
+}
+
+TEST_F(AdaptiveListTest, EraseAfterConvertsToLinked) {
+    IntList list = {1, 2, 3};
+
+    auto it = list.eraseAfter(list.beforeBegin());
+
+    EXPECT_FALSE(list.isContiguous());
+    EXPECT_EQ(*it, 2);
+    EXPECT_EQ(values(list), (std::vector<int>{2, 3}));
+    EXPECT_THROW(list.eraseAfter(std::next(list.begin())), std::out_of_range);
+}
+
+TEST_F(AdaptiveListTest, SpliceAfterMovesAllElements) {
+    StringList list({"a", "d"}, stringAlloc);
+    StringList other({"b", "c"}, stringAlloc);
+
+    list.spliceAfter(list.begin(), other);
+
+    EXPECT_FALSE(list.isContiguous());
+    EXPECT_TRUE(other.isEmpty());
+    EXPECT_TRUE(other.isContiguous());
+    EXPECT_EQ(values(list), (std::vector<std::string>{"a", "b", "c", "d"}));
+
+    other.pushBack("e");
+    EXPECT_EQ(values(other), (std::vector<std::string>{"e"}));
+}
+
+TEST_F(AdaptiveListTest, SpliceAfterMovesRange) {
+    StringList list({"a", "e"}, stringAlloc);
+    StringList other({"x", "b", "c", "d"}, stringAlloc);
+
+    list.spliceAfter(list.begin(), other, other.begin(), std::next(other.begin(), 3));
+    EXPECT_EQ(values(list), (std::vector<std::string>{"a", "b", "c", "e"}));
+    EXPECT_EQ(values(other), (std::vector<std::string>{"x", "d"}));
+
+    list.spliceAfter(std::next(list.begin(), 2), other, other.beforeBegin(), other.end());
+    EXPECT_EQ(values(list), (std::vector<std::string>{"a", "b", "c", "x", "d", "e"}));
+    EXPECT_TRUE(other.isEmpty());
+    EXPECT_TRUE(other.isContiguous());
+}
+
+// ============ Возврат к кольцу ============
+TEST_F(AdaptiveListTest, CompactsAfterEndOperations) {
+    IntList list = {0, 1, 2};
+    list.insertAfter(list.beforeBegin(), -1);
+    ASSERT_FALSE(list.isContiguous());
+
+    // Очередь: размер остаётся малым, порог - MIN_COMPACT_OPS операций
+    int next = 3;
+    for (size_t i = 0; i + 1 < IntList::MIN_COMPACT_OPS; ++i) {
+        if (i % 2 == 0) {
+            list.pushBack(next++);
+        } else {
+            list.popFront();
+        }
+    }
+    EXPECT_FALSE(list.isContiguous());
+
+    list.pushBack(next);
+    EXPECT_TRUE(list.isContiguous());
+
+    std::vector<int> expected;
+    for (int value = next - static_cast<int>(list.getSize()) + 1; value <= next; ++value) {
+        expected.push_back(value);
+    }
+    EXPECT_EQ(values(list), expected);
+}
+
+// Каждая вставка в середину откладывает сжатие
+TEST_F(AdaptiveListTest, MiddleInsertionsKeepLinked) {
+    IntList list = {0, 1};
+
+    for (size_t i = 0; i < IntList::MIN_COMPACT_OPS * 2; ++i) {
+        list.insertAfter(list.begin(), static_cast<int>(i));
+        list.pushBack(-1);
+    }
+
+    EXPECT_FALSE(list.isContiguous());
+}
+
+TEST_F(AdaptiveListTest, EmptiedListBecomesContiguous) {
+    StringList list({"a", "b"}, stringAlloc);
+    list.insertAfter(list.begin(), "c");
+
+    list.popFront();
+    list.popFront();
+    EXPECT_FALSE(list.isContiguous());
+
+    EXPECT_EQ(list.popFront(), "b");
+    EXPECT_TRUE(list.isContiguous());
+    EXPECT_TRUE(list.isEmpty());
+}
+
+// Все узлы и буферы возвращаются ресурсу
+TEST_F(AdaptiveListTest, ConversionsReleaseMemory) {
+    {
+        StringList list(stringAlloc);
+        for (int round = 0; round < 3; ++round) {
+            for (int i = 0; i < 10; ++i) {
+                list.pushBack(std::string(32, 'a' + i));
+            }
+            list.insertAfter(list.begin(), "middle");
+            while (!list.isEmpty()) {
+                list.popFront();
+            }
+        }
+        list.pushBack("last");
+    }
+
+    EXPECT_GT(countingRes.allocations, 0);
+    EXPECT_EQ(countingRes.allocations, countingRes.deallocations);
+}
+
+// ============ Нехватка памяти при смене представления ============
+// Узлы выделяются до переноса значений: при отказе кольцо не меняется
+TEST_F(AdaptiveListTest, FailedSwitchToLinkedKeepsRing) {
+    std::vector<std::string> expected;
+    for (int i = 0; i < 5; ++i) {
+        expected.push_back(std::string(40, 'a' + i));
+    }
+
+    StringList list(stringAlloc);
+    for (const std::string& value : expected) {
+        list.pushBack(value);
+    }
+
+    countingRes.failAfter(2);
+    EXPECT_THROW(list.insertAfter(list.begin(), "middle"), std::bad_alloc);
+    countingRes.stopFailing();
+
+    EXPECT_TRUE(list.isContiguous());
+    EXPECT_EQ(values(list), expected);
+
+    list.insertAfter(list.begin(), "middle");
+    expected.insert(expected.begin() + 1, "middle");
+    EXPECT_EQ(values(list), expected);
+}
+
+// Сжатие в кольцо - оптимизация: при отказе список остаётся связным и целым
+TEST_F(AdaptiveListTest, FailedCompactionKeepsLinked) {
+    StringList list(stringAlloc);
+    for (size_t i = 0; i < StringList::MIN_COMPACT_OPS + 8; ++i) {
+        list.pushBack(std::string(40, 'a') + std::to_string(i));
+    }
+    list.insertAfter(list.beforeBegin(), "first");
+    ASSERT_FALSE(list.isContiguous());
+
+    countingRes.failAfter(0);
+    for (size_t i = 0; i < StringList::MIN_COMPACT_OPS; ++i) {
+        list.popBack();
+    }
+    countingRes.stopFailing();
+
+    EXPECT_FALSE(list.isContiguous());
+    ASSERT_EQ(list.getSize(), 9);
+    EXPECT_EQ(list[0], "first");
+    for (size_t i = 0; i < 8; ++i) {
+        EXPECT_EQ(list[i + 1], std::string(40, 'a') + std::to_string(i));
+    }
+
+    EXPECT_EQ(list.popFront(), "first");
+}
+
+// ============ Интерфейс ============
+TEST_F(AdaptiveListTest, IsForwardRange) {
+    static_assert(std::ranges::forward_range<IntList>);
+    static_assert(std::ranges::forward_range<const IntList>);
+
+    IntList list = {1, 2, 3, 4};
+    auto odd = list | std::views::filter([](int value) { return value % 2 == 1; });
+    EXPECT_EQ(std::ranges::distance(odd), 2);
+
+    // Смена представления делает прежние итераторы недействительными -
+    // представление views строится заново
+    list.insertAfter(list.beforeBegin(), 5);
+    auto oddLinked = list | std::views::filter([](int value) { return value % 2 == 1; });
+    EXPECT_EQ(std::ranges::distance(oddLinked), 3);
+}
+
+TEST_F(AdaptiveListTest, MoveConstructorTakesBothRepresentations) {
+    IntList ring = {1, 2};
+    IntList movedRing(std::move(ring));
+    EXPECT_TRUE(ring.isEmpty());
+    EXPECT_EQ(values(movedRing), (std::vector<int>{1, 2}));
+
+    IntList linked = {1, 3};
+    linked.insertAfter(linked.begin(), 2);
+    IntList movedLinked(std::move(linked));
+    EXPECT_TRUE(linked.isEmpty());
+    EXPECT_TRUE(linked.isContiguous());
+    EXPECT_FALSE(movedLinked.isContiguous());
+    EXPECT_EQ(values(movedLinked), (std::vector<int>{1, 2, 3}));
+}
+
+TEST_F(AdaptiveListTest, ClearResetsToRing) {
+    IntList list = {1, 2};
+    list.insertAfter(list.begin(), 3);
+
+    list.clear();
+
+    EXPECT_TRUE(list.isEmpty());
+    EXPECT_TRUE(list.isContiguous());
+    list.pushBack(4);
+    EXPECT_EQ(values(list), (std::vector<int>{4}));
+}
+
+TEST_F(AdaptiveListTest, AppendKeepsRepresentation) {
+    IntList ring = {1};
+    std::vector<int> tail = {2, 3, 4, 5, 6, 7, 8, 9, 10};
+    ring.append(tail);
+    ring.append(std::views::iota(11, 13));
+
+    EXPECT_TRUE(ring.isContiguous());
+    EXPECT_EQ(ring.getSize(), 12);
+    EXPECT_EQ(ring[11], 12);
+
+    IntList linked = {1, 3};
+    linked.insertAfter(linked.begin(), 2);
+    linked.append(std::vector<int>{4, 5});
+    EXPECT_FALSE(linked.isContiguous());
+    EXPECT_EQ(values(linked), (std::vector<int>{1, 2, 3, 4, 5}));
+}
+
+TEST_F(AdaptiveListTest, CloneIsContiguousCopy) {
+    StringList list({"a", "c"}, stringAlloc);
+    list.insertAfter(list.begin(), "b");
+
+    StringList copy = list.clone();
+
+    EXPECT_TRUE(copy.isContiguous());
+    EXPECT_EQ(values(copy), (std::vector<std::string>{"a", "b", "c"}));
+    EXPECT_EQ(values(list), (std::vector<std::string>{"a", "b", "c"}));
+}
+
+TEST_F(AdaptiveListTest, SortAndReverseInBothRepresentations) {
+    // Кольцо, перешедшее через конец буфера
+    IntList ring = {5, 3, 8};
+    ring.pushFront(1);
+    ring.pushFront(9);
+    ring.sort();
+    EXPECT_TRUE(ring.isContiguous());
+    EXPECT_EQ(values(ring), (std::vector<int>{1, 3, 5, 8, 9}));
+
+    ring.reverse();
+    EXPECT_EQ(values(ring), (std::vector<int>{9, 8, 5, 3, 1}));
+
+    IntList linked = {4, 1};
+    linked.insertAfter(linked.begin(), 7);
+    linked.sort(std::greater<int>{});
+    EXPECT_EQ(values(linked), (std::vector<int>{7, 4, 1}));
+    linked.reverse();
+    EXPECT_EQ(values(linked), (std::vector<int>{1, 4, 7}));
+}
+
+TEST_F(AdaptiveListTest, MergeEmptiesOther) {
+    IntList list = {1, 4, 6};
+    IntList other = {2, 4, 5};
+
+    list.merge(other);
+
+    EXPECT_EQ(values(list), (std::vector<int>{1, 2, 4, 4, 5, 6}));
+    EXPECT_TRUE(other.isEmpty());
+    EXPECT_TRUE(other.isContiguous());
+}
+
+TEST_F(AdaptiveListTest, UniqueKeepsRepresentation) {
+    StringList ring({"a", "a", "b", "b", "b", "a", "c", "c"}, stringAlloc);
+    EXPECT_EQ(ring.unique(), 4);
+    EXPECT_TRUE(ring.isContiguous());
+    EXPECT_EQ(values(ring), (std::vector<std::string>{"a", "b", "a", "c"}));
+
+    IntList linked = {1, 1, 2};
+    linked.insertAfter(linked.begin(), 1);
+    EXPECT_EQ(linked.unique(), 2);
+    EXPECT_FALSE(linked.isContiguous());
+    EXPECT_EQ(values(linked), (std::vector<int>{1, 2}));
+}
@@ -0,0 +1,143 @@
+#include <gtest/gtest.h>
+#include "../include/ColumnarList.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+struct Point3D {
+    double x, y, z;
+};
+
+struct Student {
+    std::string name;
+    int age;
+    double gpa;
+};
+
+template <>
+struct ColumnarLayout<Point3D> {
+    static constexpr auto fields = std::make_tuple(&Point3D::x, &Point3D::y, &Point3D::z);
+};
+
+template <>
+struct ColumnarLayout<Student> {
+    static constexpr auto fields = std::make_tuple(&Student::name, &Student::age, &Student::gpa);
+};
+
+// Тесты столбцового списка и ядер над столбцами
+class ColumnarListTest : public ::testing::Test {
+protected:
+    using PointList = ColumnarList<Point3D>;
+    using StudentList = ColumnarList<Student>;
+
+    static constexpr size_t MANY = PointList::CHUNK_SIZE * 3 + 17;
+};
+
+// ============ Тесты структуры ============
+TEST_F(ColumnarListTest, ColumnIndexByMember) {
+    EXPECT_EQ(PointList::columnIndex<&Point3D::x>(), 0);
+    EXPECT_EQ(PointList::columnIndex<&Point3D::z>(), 2);
+    EXPECT_EQ(StudentList::columnIndex<&Student::gpa>(), 2);
+}
+
+TEST_F(ColumnarListTest, PushAndPopAtBothEnds) {
+    StudentList list;
+
+    list.pushBack({"Bob", 21, 3.5});
+    list.pushFront({"Alice", 20, 3.8});
+    list.pushBack({"Charlie", 19, 3.9});
+
+    EXPECT_EQ(list.getSize(), 3);
+    EXPECT_EQ(list[0].name, "Alice");
+    EXPECT_EQ(list[2].age, 19);
+
+    EXPECT_EQ(list.popBack().name, "Charlie");
+    EXPECT_EQ(list.popFront().name, "Alice");
+    EXPECT_EQ(list.popFront().gpa, 3.5);
+    EXPECT_TRUE(list.isEmpty());
+    EXPECT_THROW(list.popBack(), std::out_of_range);
+    EXPECT_THROW(list[0], std::out_of_range);
+}
+
+TEST_F(ColumnarListTest, CrossesChunkBoundaries) {
+    PointList list;
+
+    for (size_t i = 0; i < MANY; ++i) {
+        list.pushBack({double(i), 0.0, 0.0});
+        list.pushFront({-double(i) - 1, 0.0, 0.0});
+    }
+
+    EXPECT_EQ(list.getSize(), MANY * 2);
+    for (size_t i = 0; i < MANY * 2; ++i) {
+        EXPECT_EQ(list.field<&Point3D::x>(i), double(i) - double(MANY));
+    }
+
+    for (size_t i = 0; i < MANY; ++i) {
+        EXPECT_EQ(list.popFront().x, -double(MANY) + double(i));
+    }
+    for (size_t i = 0; i < MANY; ++i) {
+        EXPECT_EQ(list.popBack().x, double(MANY - 1 - i));
+    }
+    EXPECT_TRUE(list.isEmpty());
+
+    list.pushFront({1.0, 2.0, 3.0});
+    EXPECT_EQ(list[0].z, 3.0);
+}
+
+TEST_F(ColumnarListTest, UsesGivenAllocator) {
+    // Кусок из трёх столбцов больше буфера MemoryResource
+    std::vector<std::byte> buffer(PointList::CHUNK_SIZE * sizeof(Point3D) * 2);
+    std::pmr::monotonic_buffer_resource resource(buffer.data(), buffer.size(), std::pmr::null_memory_resource());
+    ColumnarList<Point3D, std::pmr::polymorphic_allocator<Point3D>> list({{1, 2, 3}, {4, 5, 6}}, &resource);
+
+    EXPECT_EQ(list[1].y, 5.0);
+    EXPECT_EQ(list.popFront().x, 1.0);
+}
+
+// ============ Тесты ядер ============
+TEST_F(ColumnarListTest, ColumnSum) {
+    StudentList list;
+    double expected = 0.0;
+
+    for (size_t i = 0; i < MANY; ++i) {
+        list.pushBack({"s", int(i), 2.0 + (i % 5) * 0.5});
+        expected += 2.0 + (i % 5) * 0.5;
+    }
+
+    EXPECT_DOUBLE_EQ(columnSum<&Student::gpa>(list), expected);
+    EXPECT_EQ(columnSum<&Student::age>(list), int(MANY * (MANY - 1) / 2));
+    EXPECT_EQ(columnSum<&Student::gpa>(StudentList()), 0.0);
+}
+
+TEST_F(ColumnarListTest, ColumnNormsMatchNodeOrder) {
+    PointList list;
+
+    for (size_t i = 0; i < MANY; ++i) {
+        list.pushBack({double(i), double(i % 7), double(i % 13)});
+    }
+    list.popFront();
+    list.pushFront({3.0, 4.0, 0.0});
+
+    std::vector<double> norms;
+    columnNorms<&Point3D::x, &Point3D::y, &Point3D::z>(list, norms);
+
+    ASSERT_EQ(norms.size(), MANY);
+    EXPECT_DOUBLE_EQ(norms[0], 5.0);
+    for (size_t i = 1; i < MANY; ++i) {
+        EXPECT_DOUBLE_EQ(norms[i], std::sqrt(double(i * i) + (i % 7) * (i % 7) + (i % 13) * (i % 13)));
+    }
+}
+
+TEST_F(ColumnarListTest, FilterByField) {
+    StudentList list({{"Alice", 20, 3.8}, {"Bob", 21, 3.5}, {"Charlie", 19, 3.9}, {"David", 20, 3.7}});
+
+    auto honors = [](double gpa) { return gpa > 3.6; };
+    std::vector<size_t> selected;
+    columnSelect<&Student::gpa>(list, honors, selected);
+
+    EXPECT_EQ(columnCountIf<&Student::gpa>(list, honors), 3);
+    EXPECT_EQ(selected, (std::vector<size_t>{0, 2, 3}));
+}
@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+#include "../include/CompactLinkedList.hpp"
+#include "../include/MemoryResource.hpp"
+
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+// Тесты компактного списка с 32-битными относительными связями
+class CompactLinkedListTest : public ::testing::Test {
+protected:
+    MemoryResource mres;
+    std::pmr::polymorphic_allocator<CompactListItem<int>> polyAlloc{&mres};
+
+    using ListType = CompactLinkedList<int, std::pmr::polymorphic_allocator<CompactListItem<int>>>;
+
+    static std::vector<int> collect(ListType& list) {
+        std::vector<int> values;
+        for (auto it = list.begin(); it != list.end(); ++it) {
+            values.push_back(*it);
+        }
+        return values;
+    }
+};
+
+TEST_F(CompactLinkedListTest, NodeIsHalfTheSize) {
+    EXPECT_EQ(sizeof(CompactListItem<int>), 8);
+}
+
+TEST_F(CompactLinkedListTest, ConstructorWithInitializerList) {
+    ListType list({1, 2, 3}, polyAlloc);
+
+    EXPECT_EQ(list.getSize(), 3);
+    EXPECT_EQ(list[0], 1);
+    EXPECT_EQ(list[2], 3);
+    EXPECT_THROW(list[3], std::out_of_range);
+}
+
+TEST_F(CompactLinkedListTest, PushAndPop) {
+    ListType list(polyAlloc);
+
+    list.pushBack(2);
+    list.pushFront(1);
+    list.pushBack(3);
+
+    EXPECT_EQ(collect(list), (std::vector<int>{1, 2, 3}));
+    EXPECT_EQ(list.popBack(), 3);
+    EXPECT_EQ(list.popFront(), 1);
+    EXPECT_EQ(list.popFront(), 2);
+    EXPECT_TRUE(list.isEmpty());
+    EXPECT_THROW(list.popFront(), std::out_of_range);
+}
+
+TEST_F(CompactLinkedListTest, FreedItemsAreReused) {
+    ListType list({1, 2, 3}, polyAlloc);
+
+    list.popFront();
+    list.pushBack(4);
+
+    EXPECT_EQ(list.arenaItems(), 3);
+    EXPECT_EQ(collect(list), (std::vector<int>{2, 3, 4}));
+}
+
+TEST_F(CompactLinkedListTest, GrowthRelocatesArena) {
+    ListType list(polyAlloc);
+
+    for (int i = 0; i < 100; ++i) {
+        list.pushBack(i);
+    }
+
+    EXPECT_GE(list.getCapacity(), 100);
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(list[i], i);
+    }
+}
+
+TEST_F(CompactLinkedListTest, NodesAreContiguous) {
+    ListType list({1, 2, 3, 4}, polyAlloc);
+
+    EXPECT_EQ(&list[1], &list[0] + 2);  // value занимает половину узла
+}
+
+TEST_F(CompactLinkedListTest, ImportArenaAtDifferentAddress) {
+    ListType list({5, 6, 7}, polyAlloc);
+    list.popFront();
+    list.pushFront(4);
+
+    std::vector<CompactListItem<int>> copy(list.arenaData(), list.arenaData() + list.arenaItems());
+    auto state = list.exportState();
+
+    ListType restored = ListType::importArena(copy.data(), state, polyAlloc);
+
+    EXPECT_EQ(collect(restored), (std::vector<int>{4, 6, 7}));
+    restored.pushBack(8);
+    EXPECT_EQ(restored.popBack(), 8);
+}
+
+TEST_F(CompactLinkedListTest, NonTrivialElements) {
+    std::pmr::polymorphic_allocator<CompactListItem<std::string>> stringAlloc{std::pmr::new_delete_resource()};
+    CompactLinkedList<std::string, std::pmr::polymorphic_allocator<CompactListItem<std::string>>> list(stringAlloc);
+
+    for (int i = 0; i < 20; ++i) {
+        list.pushBack("value number " + std::to_string(i));
+    }
+
+    EXPECT_EQ(list[19], "value number 19");
+    EXPECT_EQ(list.popFront(), "value number 0");
+}
+
+TEST_F(CompactLinkedListTest, MoveConstructor) {
+    ListType list({1, 2}, polyAlloc);
+    ListType moved(std::move(list));
+
+    EXPECT_TRUE(list.isEmpty());
+    EXPECT_EQ(collect(moved), (std::vector<int>{1, 2}));
+}
@@ -0,0 +1,137 @@
+#include <gtest/gtest.h>
+#include "../include/ConcurrentLinkedList.hpp"
+
+#include <atomic>
+#include <memory_resource>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Тесты lock-free списка (общий стек между потоками)
+class ConcurrentLinkedListTest : public ::testing::Test {
+protected:
+    std::pmr::synchronized_pool_resource pool;
+    std::pmr::polymorphic_allocator<int> polyAlloc{&pool};
+
+    using ListType = ConcurrentLinkedList<int>;
+};
+
+// ============ Однопоточное поведение ============
+TEST_F(ConcurrentLinkedListTest, EmptyOnConstruction) {
+    ListType list(polyAlloc);
+
+    EXPECT_TRUE(list.isEmpty());
+    EXPECT_EQ(list.getSize(), 0);
+
+    int value = 0;
+    EXPECT_FALSE(list.tryPopFront(value));
+    EXPECT_THROW(list.popFront(), std::out_of_range);
+}
+
+TEST_F(ConcurrentLinkedListTest, PushPopIsLifo) {
+    ListType list(polyAlloc);
+
+    for (int i = 1; i <= 5; ++i) {
+        list.pushFront(i);
+    }
+
+    EXPECT_EQ(list.getSize(), 5);
+    for (int i = 5; i >= 1; --i) {
+        EXPECT_EQ(list.popFront(), i);
+    }
+    EXPECT_TRUE(list.isEmpty());
+}
+
+TEST_F(ConcurrentLinkedListTest, NodesAreRecycled) {
+    ListType list(polyAlloc);
+
+    list.pushFront(1);
+    list.popFront();
+    list.pushFront(2);
+
+    EXPECT_EQ(list.getSize(), 1);
+    EXPECT_EQ(list.popFront(), 2);
+}
+
+TEST_F(ConcurrentLinkedListTest, NonTrivialElements) {
+    std::pmr::polymorphic_allocator<std::string> stringAlloc{&pool};
+    ConcurrentLinkedList<std::string> list(stringAlloc);
+
+    list.pushFront(std::string("a long string that does not fit into SSO buffer"));
+    list.emplaceFront(3, 'x');
+
+    EXPECT_EQ(list.popFront(), "xxx");
+
+    // Оставшийся элемент уничтожается деструктором списка
+}
+
+// ============ Многопоточное поведение ============
+TEST_F(ConcurrentLinkedListTest, ConcurrentPushesKeepAllElements) {
+    ListType list(polyAlloc);
+    const int threadCount = 4;
+    const int perThread = 5000;
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; ++t) {
+        threads.emplace_back([&list, t, perThread]() {
+            for (int i = 0; i < perThread; ++i) {
+                list.pushFront(t * perThread + i);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(list.getSize(), threadCount * perThread);
+
+    std::vector<bool> seen(threadCount * perThread, false);
+    int value = 0;
+    while (list.tryPopFront(value)) {
+        EXPECT_FALSE(seen[value]);
+        seen[value] = true;
+    }
+
+    for (bool wasSeen : seen) {
+        EXPECT_TRUE(wasSeen);
+    }
+}
+
+TEST_F(ConcurrentLinkedListTest, ProducersAndConsumers) {
+    ListType list(polyAlloc);
+    const int producerCount = 3;
+    const int consumerCount = 3;
+    const int perProducer = 5000;
+
+    std::atomic<long long> poppedSum(0);
+    std::atomic<int> poppedCount(0);
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producerCount; ++p) {
+        threads.emplace_back([&list, perProducer]() {
+            for (int i = 1; i <= perProducer; ++i) {
+                list.pushFront(i);
+            }
+        });
+    }
+    for (int c = 0; c < consumerCount; ++c) {
+        threads.emplace_back([&]() {
+            int value = 0;
+            while (poppedCount.load() < producerCount * perProducer) {
+                if (list.tryPopFront(value)) {
+                    poppedSum += value;
+                    ++poppedCount;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    long long expectedSum = static_cast<long long>(producerCount) * perProducer * (perProducer + 1) / 2;
+    EXPECT_EQ(poppedSum.load(), expectedSum);
+    EXPECT_TRUE(list.isEmpty());
+}
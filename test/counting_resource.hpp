@@ -0,0 +1,52 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <limits>
+#include <memory_resource>
+#include <new>
+
+// Ресурс для тестов: считает вызовы выделения и освобождения (счётчики
+// атомарные, ресурс можно делить между потоками) и по запросу отказывает
+// в выделении, чтобы проверить поведение контейнеров при нехватке памяти
+class CountingResource : public std::pmr::memory_resource {
+public:
+    std::atomic<size_t> allocations{0};
+    std::atomic<size_t> deallocations{0};
+
+    // Блоки, выделенные и ещё не освобождённые
+    long liveBlocks() const {
+        return static_cast<long>(this->allocations) - static_cast<long>(this->deallocations);
+    }
+
+    // Следующие count выделений проходят, дальше ресурс бросает std::bad_alloc
+    void failAfter(size_t count) {
+        this->_allocationLimit = this->allocations + count;
+    }
+
+    void stopFailing() {
+        this->_allocationLimit = std::numeric_limits<size_t>::max();
+    }
+
+protected:
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        if (this->allocations >= this->_allocationLimit) {
+            throw std::bad_alloc();
+        }
+
+        ++this->allocations;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* ptr, size_t bytes, size_t alignment) override {
+        ++this->deallocations;
+        std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+private:
+    std::atomic<size_t> _allocationLimit{std::numeric_limits<size_t>::max()};
+};
@@ -0,0 +1,161 @@
+#include <gtest/gtest.h>
+#include "../include/HotColdList.hpp"
+#include "../include/LinkedList.hpp"
+#include "counting_resource.hpp"
+
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+struct Book {
+    std::string title;
+    std::string author;
+    int year;
+    int pages;
+};
+
+template <>
+struct HotColdLayout<Book> {
+    static constexpr auto hot = std::make_tuple(&Book::year, &Book::pages);
+};
+
+// Тесты списка с горячими полями в узле
+class HotColdListTest : public ::testing::Test {
+protected:
+    using BookList = HotColdList<Book>;
+    using PerNodeBookList = HotColdList<Book, std::allocator<Book>, PerNodeAllocation>;
+    using PmrBookList = HotColdList<Book, std::pmr::polymorphic_allocator<Book>>;
+
+    BookList list{
+        {"Dune", "Herbert", 1965, 412},
+        {"Neuromancer", "Gibson", 1984, 271},
+        {"Hyperion", "Simmons", 1989, 482},
+    };
+
+    static std::vector<std::string> titles(BookList& books) {
+        std::vector<std::string> result;
+        while (!books.isEmpty()) {
+            result.push_back(books.popFront().title);
+        }
+        return result;
+    }
+};
+
+// ============ Тесты структуры ============
+TEST_F(HotColdListTest, HotFieldsByMember) {
+    static_assert(BookList::isHot<&Book::year>());
+    static_assert(BookList::isHot<&Book::pages>());
+    static_assert(!BookList::isHot<&Book::title>());
+    static_assert(BookList::hotIndex<&Book::pages>() == 1);
+}
+
+// Узел без холодной части меньше узла с полным значением
+TEST_F(HotColdListTest, NodeIsSmallerThanListItem) {
+    static_assert(sizeof(BookList::itemType) <= 3 * sizeof(void*));
+    static_assert(sizeof(BookList::itemType) * 3 < sizeof(ListItem<Book>));
+}
+
+// ============ Тесты операций ============
+TEST_F(HotColdListTest, ElementsAreAssembled) {
+    Book book = list[1];
+
+    EXPECT_EQ(book.title, "Neuromancer");
+    EXPECT_EQ(book.author, "Gibson");
+    EXPECT_EQ(book.year, 1984);
+    EXPECT_EQ(book.pages, 271);
+    EXPECT_THROW(list[3], std::out_of_range);
+}
+
+TEST_F(HotColdListTest, FieldAccessReadsAndWrites) {
+    list.field<&Book::year>(0) = 1966;
+    list.field<&Book::author>(2) = "Dan Simmons";
+
+    EXPECT_EQ(list[0].year, 1966);
+    EXPECT_EQ(list[2].author, "Dan Simmons");
+    EXPECT_EQ(list.field<&Book::title>(1), "Neuromancer");
+}
+
+TEST_F(HotColdListTest, PushAndPop) {
+    list.pushFront({"Foundation", "Asimov", 1951, 255});
+    list.pushBack({"Solaris", "Lem", 1961, 204});
+
+    EXPECT_EQ(list.getSize(), 5);
+    EXPECT_EQ(titles(list), (std::vector<std::string>{"Foundation", "Dune", "Neuromancer", "Hyperion", "Solaris"}));
+    EXPECT_THROW(list.popFront(), std::out_of_range);
+
+    list.pushBack({"Ubik", "Dick", 1969, 202});
+    EXPECT_EQ(list.popFront().year, 1969);
+    EXPECT_TRUE(list.isEmpty());
+}
+
+// ============ Проходы по ключу ============
+TEST_F(HotColdListTest, ForEachHotVisitsFields) {
+    std::vector<int> years;
+    int pages = 0;
+
+    list.forEachHot<&Book::year, &Book::pages>([&](int year, int bookPages) {
+        years.push_back(year);
+        pages += bookPages;
+    });
+
+    EXPECT_EQ(years, (std::vector<int>{1965, 1984, 1989}));
+    EXPECT_EQ(pages, 412 + 271 + 482);
+}
+
+TEST_F(HotColdListTest, FindIfLoadsMatch) {
+    auto found = list.findIf<&Book::year>([](int year) { return year > 1980; });
+    ASSERT_TRUE(found.has_value());
+    EXPECT_EQ(found->title, "Neuromancer");
+
+    auto missing = list.findIf<&Book::year, &Book::pages>([](int year, int pages) { return year < 1960 && pages > 0; });
+    EXPECT_FALSE(missing.has_value());
+}
+
+// ============ Память ============
+TEST_F(HotColdListTest, MemoryReturnedToResource) {
+    CountingResource countingRes;
+    {
+        PmrBookList books{std::pmr::polymorphic_allocator<Book>(&countingRes)};
+        for (int i = 0; i < 100; ++i) {
+            books.pushBack({std::string(40, 'a'), "author", 2000 + i, i});
+        }
+        for (int i = 0; i < 50; ++i) {
+            EXPECT_EQ(books.popFront().year, 2000 + i);
+        }
+    }
+
+    EXPECT_GT(countingRes.allocations, 0);
+    EXPECT_EQ(countingRes.allocations, countingRes.deallocations);
+}
+
+// Узлы и холодные части в разных областях: узлы соседних элементов лежат рядом
+TEST_F(HotColdListTest, NodesArePackedTogether) {
+    BookList books;
+    for (int i = 0; i < 8; ++i) {
+        books.pushBack({"title", "author", i, i});
+    }
+
+    const int* first = &books.field<&Book::year>(0);
+    const int* last = &books.field<&Book::year>(7);
+    auto distance = reinterpret_cast<const std::byte*>(last) - reinterpret_cast<const std::byte*>(first);
+
+    EXPECT_EQ(static_cast<size_t>(distance), 7 * sizeof(BookList::itemType));
+}
+
+TEST_F(HotColdListTest, PerNodeAllocationPolicy) {
+    PerNodeBookList books = {{"Dune", "Herbert", 1965, 412}, {"Ubik", "Dick", 1969, 202}};
+
+    EXPECT_EQ(books.findIf<&Book::pages>([](int pages) { return pages < 300; })->title, "Ubik");
+    EXPECT_EQ(books.popFront().title, "Dune");
+}
+
+TEST_F(HotColdListTest, MoveKeepsElements) {
+    BookList moved(std::move(list));
+
+    EXPECT_TRUE(list.isEmpty());
+    EXPECT_EQ(moved.getSize(), 3);
+    EXPECT_EQ(titles(moved), (std::vector<std::string>{"Dune", "Neuromancer", "Hyperion"}));
+
+    list.pushBack({"Ubik", "Dick", 1969, 202});
+    EXPECT_EQ(list[0].title, "Ubik");
+}
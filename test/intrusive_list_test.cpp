@@ -0,0 +1,294 @@
+#include <gtest/gtest.h>
+#include "../include/IntrusiveList.hpp"
+
+#include <cstdlib>
+#include <iterator>
+#include <new>
+#include <ranges>
+#include <string>
+#include <vector>
+
+// Счётчик вызовов глобального operator new в этом тесте
+static size_t globalNewCalls = 0;
+
+void* operator new(size_t size) {
+    ++globalNewCalls;
+    if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept {
+    std::free(ptr);
+}
+
+// Крючок - базовый класс
+struct Student : public IntrusiveListHook {
+    std::string name;
+    int group;
+
+    Student(std::string studentName = "", int studentGroup = 0) : name(std::move(studentName)), group(studentGroup) {}
+};
+
+// Два крючка-поля: запись одновременно в двух списках
+struct Order {
+    int id;
+    IntrusiveListHook byArrival;
+    IntrusiveListHook byPriority;
+};
+
+// Тесты интрузивного списка
+class IntrusiveListTest : public ::testing::Test {
+protected:
+    using StudentList = IntrusiveList<Student>;
+    using ArrivalList = IntrusiveList<Order, &Order::byArrival>;
+    using PriorityList = IntrusiveList<Order, &Order::byPriority>;
+
+    // Пул записей, которыми владеет тест
+    std::vector<Student> pool{{"Alice", 1}, {"Bob", 2}, {"Charlie", 1}, {"David", 3}};
+
+    template <typename ListType>
+    static std::vector<std::string> names(ListType& list) {
+        std::vector<std::string> values;
+        for (const Student& student : list) {
+            values.push_back(student.name);
+        }
+        return values;
+    }
+
+    void TearDown() override {
+        for (Student& student : pool) {
+            ASSERT_FALSE(student.isLinked());
+        }
+    }
+};
+
+// ============ Вставка и удаление ============
+TEST_F(IntrusiveListTest, PushFrontAndBack) {
+    StudentList list;
+
+    list.pushBack(pool[1]);
+    list.pushFront(pool[0]);
+    list.pushBack(pool[2]);
+
+    EXPECT_EQ(list.getSize(), 3);
+    EXPECT_EQ(&list.front(), &pool[0]);
+    EXPECT_EQ(&list.back(), &pool[2]);
+    EXPECT_EQ(names(list), (std::vector<std::string>{"Alice", "Bob", "Charlie"}));
+}
+
+TEST_F(IntrusiveListTest, PopReturnsSameObjects) {
+    StudentList list;
+    for (Student& student : pool) {
+        list.pushBack(student);
+    }
+
+    EXPECT_EQ(&list.popFront(), &pool[0]);
+    EXPECT_EQ(&list.popBack(), &pool[3]);
+    EXPECT_EQ(list.getSize(), 2);
+    EXPECT_FALSE(pool[0].isLinked());
+    EXPECT_TRUE(pool[1].isLinked());
+
+    list.clear();
+}
+
+TEST_F(IntrusiveListTest, PopFromEmptyThrows) {
+    StudentList list;
+
+    EXPECT_THROW(list.popFront(), std::out_of_range);
+    EXPECT_THROW(list.popBack(), std::out_of_range);
+}
+
+TEST_F(IntrusiveListTest, EraseByReference) {
+    StudentList list;
+    for (Student& student : pool) {
+        list.pushBack(student);
+    }
+
+    list.erase(pool[2]);
+    list.erase(pool[0]);
+
+    EXPECT_EQ(names(list), (std::vector<std::string>{"Bob", "David"}));
+    EXPECT_FALSE(pool[2].isLinked());
+
+    // Отвязанный элемент можно вставить снова
+    list.pushFront(pool[2]);
+    EXPECT_EQ(names(list), (std::vector<std::string>{"Charlie", "Bob", "David"}));
+
+    list.clear();
+}
+
+TEST_F(IntrusiveListTest, InsertAndEraseByIterator) {
+    StudentList list;
+    list.pushBack(pool[0]);
+    list.pushBack(pool[3]);
+
+    auto it = list.insert(std::next(list.begin()), pool[1]);
+    EXPECT_EQ(&*it, &pool[1]);
+
+    it = list.erase(list.iteratorTo(pool[0]));
+    EXPECT_EQ(&*it, &pool[1]);
+    EXPECT_EQ(names(list), (std::vector<std::string>{"Bob", "David"}));
+
+    list.clear();
+}
+
+// ============ Обход ============
+TEST_F(IntrusiveListTest, BidirectionalRange) {
+    static_assert(std::ranges::bidirectional_range<StudentList>);
+    static_assert(std::ranges::bidirectional_range<const StudentList>);
+
+    StudentList list;
+    for (Student& student : pool) {
+        list.pushBack(student);
+    }
+
+    std::vector<std::string> reversed;
+    for (const Student& student : list | std::views::reverse) {
+        reversed.push_back(student.name);
+    }
+    EXPECT_EQ(reversed, (std::vector<std::string>{"David", "Charlie", "Bob", "Alice"}));
+
+    auto firstGroup = list | std::views::filter([](const Student& s) { return s.group == 1; });
+    EXPECT_EQ(std::ranges::distance(firstGroup), 2);
+
+    list.clear();
+}
+
+// ============ Крючки-поля ============
+TEST_F(IntrusiveListTest, ElementInTwoLists) {
+    std::vector<Order> orders(3);
+    for (int i = 0; i < 3; ++i) {
+        orders[i].id = i;
+    }
+
+    ArrivalList arrival;
+    PriorityList priority;
+    for (Order& order : orders) {
+        arrival.pushBack(order);
+        priority.pushFront(order);
+    }
+
+    EXPECT_EQ(arrival.front().id, 0);
+    EXPECT_EQ(priority.front().id, 2);
+
+    // Удаление из одного списка не трогает другой
+    priority.erase(orders[1]);
+    EXPECT_EQ(arrival.getSize(), 3);
+    EXPECT_EQ(priority.getSize(), 2);
+    EXPECT_TRUE(orders[1].byArrival.isLinked());
+    EXPECT_FALSE(orders[1].byPriority.isLinked());
+
+    std::vector<int> ids;
+    for (Order& order : priority) {
+        ids.push_back(order.id);
+    }
+    EXPECT_EQ(ids, (std::vector<int>{2, 0}));
+}
+
+// ============ Память ============
+TEST_F(IntrusiveListTest, OperationsDoNotAllocate) {
+    StudentList list;
+    size_t callsBefore = globalNewCalls;
+
+    for (int round = 0; round < 100; ++round) {
+        for (Student& student : pool) {
+            list.pushBack(student);
+        }
+        list.erase(pool[1]);
+        list.popFront();
+        list.pushFront(pool[1]);
+        list.clear();
+    }
+
+    EXPECT_EQ(globalNewCalls, callsBefore);
+}
+
+TEST_F(IntrusiveListTest, MoveKeepsElements) {
+    StudentList list;
+    list.pushBack(pool[0]);
+    list.pushBack(pool[1]);
+
+    StudentList moved(std::move(list));
+
+    EXPECT_TRUE(list.isEmpty());
+    EXPECT_EQ(names(moved), (std::vector<std::string>{"Alice", "Bob"}));
+    EXPECT_EQ(&moved.popBack(), &pool[1]);
+
+    // Элементы принадлежат новому списку и удаляются из него по ссылке
+    moved.erase(pool[0]);
+    EXPECT_TRUE(moved.isEmpty());
+}
+
+TEST_F(IntrusiveListTest, DestructorUnlinksElements) {
+    {
+        StudentList list;
+        list.pushBack(pool[0]);
+        list.pushBack(pool[1]);
+    }
+
+    EXPECT_FALSE(pool[0].isLinked());
+    EXPECT_FALSE(pool[1].isLinked());
+}
+
+// Копия элемента не состоит в списке
+TEST_F(IntrusiveListTest, CopiedElementIsUnlinked) {
+    StudentList list;
+    list.pushBack(pool[0]);
+
+    Student copy = pool[0];
+    EXPECT_FALSE(copy.isLinked());
+    EXPECT_EQ(copy.name, "Alice");
+
+    list.clear();
+}
+
+// ============ Безопасное отвязывание ============
+#if INTRUSIVE_LIST_SAFE_UNLINK
+TEST_F(IntrusiveListTest, DoubleLinkThrows) {
+    StudentList first;
+    StudentList second;
+    first.pushBack(pool[0]);
+
+    EXPECT_THROW(first.pushBack(pool[0]), std::logic_error);
+    EXPECT_THROW(second.pushFront(pool[0]), std::logic_error);
+    EXPECT_EQ(first.getSize(), 1);
+    EXPECT_EQ(second.getSize(), 0);
+
+    first.clear();
+}
+
+TEST_F(IntrusiveListTest, EraseUnlinkedThrows) {
+    StudentList list;
+
+    EXPECT_THROW(list.erase(pool[0]), std::logic_error);
+}
+
+TEST_F(IntrusiveListTest, EraseFromAnotherListThrows) {
+    StudentList first;
+    StudentList second;
+    first.pushBack(pool[0]);
+    second.pushBack(pool[1]);
+
+    EXPECT_THROW(second.erase(pool[0]), std::logic_error);
+    EXPECT_EQ(first.getSize(), 1);
+    EXPECT_EQ(second.getSize(), 1);
+    EXPECT_EQ(&first.front(), &pool[0]);
+
+    first.clear();
+    second.clear();
+}
+
+TEST_F(IntrusiveListTest, DestroyLinkedElementDies) {
+    EXPECT_DEATH({
+        StudentList list;
+        Student temporary("Temporary", 0);
+        list.pushBack(temporary);
+    }, "");
+}
+#endif
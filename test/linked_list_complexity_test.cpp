@@ -0,0 +1,394 @@
+#include <gtest/gtest.h>
+#include "../include/LinkedList.hpp"
+
+#include <bit>
+#include <memory_resource>
+#include <ranges>
+#include <vector>
+
+#ifndef LINKED_LIST_COUNTERS
+#error "Complexity tests require LINKED_LIST_COUNTERS"
+#endif
+
+// Тесты асимптотики: операции считаются счётчиками списка, а не временем,
+// поэтому квадратичное поведение ловится на любой машине и в Debug-сборке
+class LinkedListComplexityTest : public ::testing::Test {
+protected:
+    using ListType = LinkedList<int, std::pmr::polymorphic_allocator<ListItem<int>>>;
+    using SlabListType = LinkedList<int, std::pmr::polymorphic_allocator<ListItem<int>>, SlabAllocation>;
+    using IndexedListType = LinkedList<int, std::pmr::polymorphic_allocator<ListItem<int>>, PerNodeAllocation, HashIndex<std::identity{}>>;
+
+    static constexpr size_t N = 4096;
+
+    // Допустимая константа в оценках вида c·N
+    static constexpr size_t C = 2;
+
+    std::pmr::unsynchronized_pool_resource pool;
+    std::pmr::polymorphic_allocator<ListItem<int>> alloc{&pool};
+
+    LinkedListCounters& counters = linkedListCounters();
+
+    void SetUp() override {
+        counters.reset();
+    }
+
+    void fill(ListType& list, size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            int value = static_cast<int>(i);
+            list.pushBack(value);
+        }
+    }
+};
+
+// ============ Вставка и удаление ============
+TEST_F(LinkedListComplexityTest, PushBackIsLinear) {
+    ListType list(alloc);
+    this->fill(list, N);
+
+    EXPECT_LE(counters.nodesVisited, C * N);
+    EXPECT_EQ(counters.allocations, N);
+    EXPECT_EQ(counters.copies, N);
+}
+
+TEST_F(LinkedListComplexityTest, PushFrontIsLinear) {
+    ListType list(alloc);
+    for (size_t i = 0; i < N; ++i) {
+        int value = static_cast<int>(i);
+        list.pushFront(value);
+    }
+
+    EXPECT_LE(counters.nodesVisited, C * N);
+    EXPECT_EQ(counters.allocations, N);
+    EXPECT_EQ(counters.copies, N);
+}
+
+TEST_F(LinkedListComplexityTest, PopFrontVisitsNothing) {
+    ListType list(alloc);
+    this->fill(list, N);
+    counters.reset();
+
+    while (!list.isEmpty()) {
+        list.popFront();
+    }
+
+    EXPECT_EQ(counters.nodesVisited, 0);
+    EXPECT_EQ(counters.deallocations, N);
+    EXPECT_EQ(counters.copies, N);
+}
+
+// popBack односвязного списка ищет предпоследний узел
+TEST_F(LinkedListComplexityTest, PopBackIsLinearPerCall) {
+    ListType list(alloc);
+    this->fill(list, N);
+    counters.reset();
+
+    list.popBack();
+
+    EXPECT_LE(counters.nodesVisited, N);
+    EXPECT_EQ(counters.deallocations, 1);
+}
+
+TEST_F(LinkedListComplexityTest, AppendRangeIsLinear) {
+    std::vector<int> source(N, 7);
+    ListType list(alloc);
+    list.append(source.begin(), source.end());
+
+    EXPECT_LE(counters.nodesVisited, C * N);
+    EXPECT_EQ(counters.allocations, N);
+    EXPECT_EQ(counters.copies, N);
+}
+
+TEST_F(LinkedListComplexityTest, DestructionReleasesEveryNodeOnce) {
+    {
+        ListType list(alloc);
+        this->fill(list, N);
+        counters.reset();
+    }
+
+    EXPECT_LE(counters.nodesVisited, C * N);
+    EXPECT_EQ(counters.deallocations, N);
+}
+
+// ============ Обход ============
+TEST_F(LinkedListComplexityTest, FullIterationVisitsN) {
+    ListType list(alloc);
+    this->fill(list, N);
+    counters.reset();
+
+    size_t seen = 0;
+    for (auto it = list.begin(); it != list.end(); ++it) {
+        ++seen;
+    }
+
+    EXPECT_EQ(seen, N);
+    EXPECT_EQ(counters.nodesVisited, N);
+    EXPECT_EQ(counters.copies, 0);
+}
+
+TEST_F(LinkedListComplexityTest, ForEachVisitsN) {
+    ListType list(alloc);
+    this->fill(list, N);
+    counters.reset();
+
+    long long sum = 0;
+    list.forEach([&sum](int value) { sum += value; });
+    EXPECT_EQ(counters.nodesVisited, N);
+
+    counters.reset();
+    list.forEach([&sum](int value) { sum += value; }, 0);
+    EXPECT_EQ(counters.nodesVisited, N);
+}
+
+TEST_F(LinkedListComplexityTest, JumpTableTraversalIsLinear) {
+    ListType list(alloc);
+    this->fill(list, N);
+    counters.reset();
+
+    auto table = list.makeJumpTable(64);
+    long long sum = 0;
+    list.forEach([&sum](int value) { sum += value; }, table);
+
+    EXPECT_LE(counters.nodesVisited, C * N);
+}
+
+TEST_F(LinkedListComplexityTest, IndexAccessIsLinearPerCall) {
+    ListType list(alloc);
+    this->fill(list, N);
+    counters.reset();
+
+    EXPECT_EQ(list[N - 1].value, static_cast<int>(N - 1));
+    EXPECT_EQ(counters.nodesVisited, N - 1);
+}
+
+// Обход через operator[] - квадратичный: счётчики это показывают
+TEST_F(LinkedListComplexityTest, IndexLoopIsQuadratic) {
+    ListType list(alloc);
+    this->fill(list, N);
+    counters.reset();
+
+    for (size_t i = 0; i < N; ++i) {
+        list[i];
+    }
+
+    EXPECT_EQ(counters.nodesVisited, N * (N - 1) / 2);
+    EXPECT_GT(counters.nodesVisited, C * N);
+}
+
+// Адаптеры views работают за один проход и ничего не выделяют
+TEST_F(LinkedListComplexityTest, ViewPipelineIsSinglePass) {
+    ListType list(alloc);
+    this->fill(list, N);
+    counters.reset();
+
+    long long sum = 0;
+    for (int value : list | std::views::filter([](int v) { return v % 3 == 0; })
+                          | std::views::transform([](int v) { return v * 2; })) {
+        sum += value;
+    }
+
+    EXPECT_GT(sum, 0);
+    EXPECT_EQ(counters.nodesVisited, N);
+    EXPECT_EQ(counters.allocations, 0);
+    EXPECT_EQ(counters.copies, 0);
+}
+
+TEST_F(LinkedListComplexityTest, TakeStopsEarly) {
+    ListType list(alloc);
+    this->fill(list, N);
+    counters.reset();
+
+    size_t taken = 0;
+    for (int value : list | std::views::take(10)) {
+        taken += (value >= 0) ? 1 : 0;
+    }
+
+    EXPECT_EQ(taken, 10);
+    EXPECT_LE(counters.nodesVisited, 10);
+}
+
+// ============ Алгоритмы ============
+TEST_F(LinkedListComplexityTest, SortIsNLogN) {
+    ListType list(alloc);
+    for (size_t i = 0; i < N; ++i) {
+        int value = static_cast<int>((i * 7919) % N);
+        list.pushBack(value);
+    }
+    counters.reset();
+
+    list.sort();
+
+    size_t logN = std::bit_width(N);
+    EXPECT_LE(counters.nodesVisited, C * N * logN);
+    EXPECT_EQ(counters.allocations, 0);
+    EXPECT_EQ(counters.copies, 0);
+}
+
+TEST_F(LinkedListComplexityTest, ReverseIsLinear) {
+    ListType list(alloc);
+    this->fill(list, N);
+    counters.reset();
+
+    list.reverse();
+
+    EXPECT_LE(counters.nodesVisited, C * N);
+    EXPECT_EQ(counters.allocations, 0);
+}
+
+TEST_F(LinkedListComplexityTest, UniqueIsLinear) {
+    ListType list(alloc);
+    for (size_t i = 0; i < N; ++i) {
+        int value = static_cast<int>(i / 4);
+        list.pushBack(value);
+    }
+    counters.reset();
+
+    EXPECT_EQ(list.unique(), N - N / 4);
+    EXPECT_LE(counters.nodesVisited, C * N);
+    EXPECT_EQ(counters.deallocations, N - N / 4);
+}
+
+TEST_F(LinkedListComplexityTest, RemoveIfIsLinear) {
+    ListType list(alloc);
+    this->fill(list, N);
+    counters.reset();
+
+    EXPECT_EQ(list.removeIf([](int value) { return value % 4 != 0; }), N - N / 4);
+    EXPECT_EQ(counters.nodesVisited, N);
+    EXPECT_EQ(counters.deallocations, N - N / 4);
+    EXPECT_EQ(counters.copies, 0);
+}
+
+TEST_F(LinkedListComplexityTest, MergeIsLinear) {
+    ListType left(alloc);
+    ListType right(alloc);
+    for (size_t i = 0; i < N; ++i) {
+        int even = static_cast<int>(2 * i);
+        int odd = static_cast<int>(2 * i + 1);
+        left.pushBack(even);
+        right.pushBack(odd);
+    }
+    counters.reset();
+
+    left.merge(right);
+
+    EXPECT_EQ(left.getSize(), 2 * N);
+    EXPECT_LE(counters.nodesVisited, C * 2 * N);
+    EXPECT_EQ(counters.allocations, 0);
+}
+
+TEST_F(LinkedListComplexityTest, CloneIsLinear) {
+    ListType list(alloc);
+    this->fill(list, N);
+    counters.reset();
+
+    ListType copy = list.clone();
+
+    EXPECT_EQ(copy.getSize(), N);
+    EXPECT_LE(counters.nodesVisited, C * N);
+    EXPECT_EQ(counters.allocations, N);
+    EXPECT_EQ(counters.copies, N);
+}
+
+// ============ Перенос узлов ============
+TEST_F(LinkedListComplexityTest, SpliceWithSharedResourceRelinksOnly) {
+    ListType target(alloc);
+    ListType source(alloc);
+    this->fill(source, N);
+    counters.reset();
+
+    target.spliceAfter(target.beforeBegin(), source);
+
+    EXPECT_EQ(target.getSize(), N);
+    EXPECT_EQ(counters.nodesVisited, 0);
+    EXPECT_EQ(counters.allocations, 0);
+    EXPECT_EQ(counters.copies, 0);
+}
+
+TEST_F(LinkedListComplexityTest, SpliceAcrossResourcesCopiesOnce) {
+    std::pmr::unsynchronized_pool_resource otherPool;
+    ListType target(alloc);
+    ListType source{std::pmr::polymorphic_allocator<ListItem<int>>(&otherPool)};
+    this->fill(source, N);
+    counters.reset();
+
+    target.spliceAfter(target.beforeBegin(), source);
+
+    EXPECT_EQ(target.getSize(), N);
+    EXPECT_LE(counters.nodesVisited, C * N);
+    EXPECT_EQ(counters.allocations, N);
+    EXPECT_EQ(counters.copies, N);
+    EXPECT_EQ(counters.deallocations, N);
+}
+
+TEST_F(LinkedListComplexityTest, SwapWithSharedResourceIsConstant) {
+    ListType left(alloc);
+    ListType right(alloc);
+    this->fill(left, N);
+    this->fill(right, N / 2);
+    counters.reset();
+
+    left.swap(right);
+
+    EXPECT_EQ(left.getSize(), N / 2);
+    EXPECT_EQ(counters.nodesVisited, 0);
+    EXPECT_EQ(counters.allocations, 0);
+    EXPECT_EQ(counters.deallocations, 0);
+}
+
+TEST_F(LinkedListComplexityTest, MoveAssignAcrossResourcesIsLinear) {
+    std::pmr::unsynchronized_pool_resource otherPool;
+    ListType target(alloc);
+    ListType source{std::pmr::polymorphic_allocator<ListItem<int>>(&otherPool)};
+    this->fill(source, N);
+    counters.reset();
+
+    target = std::move(source);
+
+    EXPECT_EQ(target.getSize(), N);
+    EXPECT_LE(counters.nodesVisited, C * N);
+    EXPECT_EQ(counters.allocations, N);
+    EXPECT_EQ(counters.copies, 0);
+}
+
+TEST_F(LinkedListComplexityTest, SlabClearSkipsTraversal) {
+    {
+        SlabListType list(N, alloc);
+        counters.reset();
+
+        list.clear();
+
+        EXPECT_EQ(counters.nodesVisited, 0);
+        EXPECT_EQ(counters.deallocations, N);
+    }
+}
+
+// ============ Хеш-индекс ============
+// Узлы с равными ключами не удлиняют серию пробирования
+static constexpr size_t PROBES_PER_NODE = 8;
+
+TEST_F(LinkedListComplexityTest, IndexedSizeConstructorIsLinear) {
+    IndexedListType list(N, alloc);
+
+    EXPECT_EQ(list.find(0), &*list.begin());
+    EXPECT_LE(counters.indexProbes, PROBES_PER_NODE * N);
+}
+
+TEST_F(LinkedListComplexityTest, IndexedDuplicateChurnIsLinear) {
+    IndexedListType list(alloc);
+    for (size_t i = 0; i < N; ++i) {
+        list.pushBack(1);
+    }
+
+    for (size_t i = 0; i < N; ++i) {
+        list.popFront();
+        list.pushBack(1);
+        list.popBack();
+        list.pushFront(1);
+    }
+
+    EXPECT_EQ(list.getSize(), N);
+    EXPECT_NE(list.find(1), nullptr);
+
+    // popBack сам по себе линеен (обход до предпоследнего узла), индекс - нет
+    EXPECT_LE(counters.indexProbes, 5 * PROBES_PER_NODE * N);
+}
@@ -2,6 +2,12 @@
 #include "../include/LinkedList.hpp"
 #include "../include/MemoryResource.hpp"
 
+#include <algorithm>
+#include <iterator>
+#include <ranges>
+#include <string>
+#include <vector>
+
 // Тесты операций LinkedList (push, pop, итератор)
 class LinkedListOperationsTest : public ::testing::Test {
 protected:
@@ -270,6 +276,23 @@ TEST_F(LinkedListOperationsTest, IteratorEquality) {
     EXPECT_NE(it1, it2);
 }
 
+// Итераторы, полученные до вставки и удаления, равны итераторам на те же узлы
+TEST_F(LinkedListOperationsTest, IteratorEqualityAcrossMutation) {
+    ListType list({1, 2, 3}, polyAlloc);
+
+    auto second = std::next(list.begin());
+    list.insertAfter(list.beforeBegin(), 0);
+
+    EXPECT_EQ(std::next(list.begin(), 2), second);
+    EXPECT_NE(std::next(list.begin()), second);
+
+    list.eraseAfter(list.beforeBegin());
+    list.eraseAfter(list.beforeBegin());
+
+    EXPECT_EQ(list.begin(), second);
+    EXPECT_NE(list.beforeBegin(), std::ranges::next(list.begin(), list.end()));
+}
+
 TEST_F(LinkedListOperationsTest, IteratorMultiplePasses) {
     ListType list({5, 10, 15}, polyAlloc);
     
@@ -373,3 +396,649 @@ TEST_F(LinkedListOperationsTest, LongSequenceOfOperations) {
     EXPECT_EQ(list[1].value, 1);
     EXPECT_EQ(list[4].value, 4);
 }
+
+// ============ Тесты insertAfter / eraseAfter ============
+TEST_F(LinkedListOperationsTest, InsertAfterBeforeBegin) {
+    ListType list({2, 3}, polyAlloc);
+
+    auto it = list.insertAfter(list.beforeBegin(), 1);
+
+    EXPECT_EQ(*it, 1);
+    EXPECT_EQ(list.getSize(), 3);
+    EXPECT_EQ(list[0].value, 1);
+    EXPECT_EQ(list[1].value, 2);
+}
+
+TEST_F(LinkedListOperationsTest, InsertAfterMiddleAndTail) {
+    ListType list({1, 3}, polyAlloc);
+
+    auto it = list.insertAfter(list.begin(), 2);
+    EXPECT_EQ(*it, 2);
+
+    ++it;
+    list.insertAfter(it, 4);
+
+    // Хвост должен обновиться, pushBack добавляет после 4
+    int v = 5;
+    list.pushBack(v);
+
+    EXPECT_EQ(list.getSize(), 5);
+    for (int i = 0; i < 5; ++i) {
+        EXPECT_EQ(list[i].value, i + 1);
+    }
+}
+
+TEST_F(LinkedListOperationsTest, InsertAfterEndThrows) {
+    ListType list({1, 2}, polyAlloc);
+
+    auto endPos = std::ranges::next(list.begin(), list.end());
+    EXPECT_THROW(list.insertAfter(endPos, 3), std::out_of_range);
+}
+
+TEST_F(LinkedListOperationsTest, EraseAfterMiddle) {
+    ListType list({1, 2, 3}, polyAlloc);
+
+    auto it = list.eraseAfter(list.begin());
+
+    EXPECT_EQ(*it, 3);
+    EXPECT_EQ(list.getSize(), 2);
+    EXPECT_EQ(list[1].value, 3);
+}
+
+TEST_F(LinkedListOperationsTest, EraseAfterTailUpdatesTail) {
+    ListType list({1, 2, 3}, polyAlloc);
+
+    auto it = list.begin();
+    ++it;
+    list.eraseAfter(it);
+
+    int v = 10;
+    list.pushBack(v);
+
+    EXPECT_EQ(list.getSize(), 3);
+    EXPECT_EQ(list[2].value, 10);
+    EXPECT_EQ(list.popBack(), 10);
+    EXPECT_EQ(list.popBack(), 2);
+}
+
+TEST_F(LinkedListOperationsTest, EraseAfterLastThrows) {
+    ListType list({1}, polyAlloc);
+
+    EXPECT_THROW(list.eraseAfter(list.begin()), std::out_of_range);
+}
+
+// ============ Тесты spliceAfter / append ============
+TEST_F(LinkedListOperationsTest, SpliceWholeListSameResource) {
+    ListType list({1, 4}, polyAlloc);
+    ListType other({2, 3}, polyAlloc);
+
+    ListItem<int>* movedItem = &other[0];
+    list.spliceAfter(list.begin(), other);
+
+    EXPECT_EQ(other.getSize(), 0);
+    EXPECT_TRUE(other.isEmpty());
+    EXPECT_EQ(list.getSize(), 4);
+    EXPECT_EQ(&list[1], movedItem);  // узлы не копировались
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_EQ(list[i].value, i + 1);
+    }
+}
+
+TEST_F(LinkedListOperationsTest, SpliceWholeListToTail) {
+    ListType list({1, 2}, polyAlloc);
+    ListType other({3, 4}, polyAlloc);
+
+    auto last = list.begin();
+    ++last;
+    list.spliceAfter(last, other);
+
+    int v = 5;
+    list.pushBack(v);
+    EXPECT_EQ(list.getSize(), 5);
+    EXPECT_EQ(list[4].value, 5);
+}
+
+TEST_F(LinkedListOperationsTest, SpliceWholeListDifferentResource) {
+    MemoryResource otherRes;
+    std::pmr::polymorphic_allocator<ListItem<int>> otherAlloc{&otherRes};
+
+    ListType list({1, 4}, polyAlloc);
+    ListType other({2, 3}, otherAlloc);
+
+    list.spliceAfter(list.begin(), other);
+
+    EXPECT_EQ(other.getSize(), 0);
+    EXPECT_EQ(list.getSize(), 4);
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_EQ(list[i].value, i + 1);
+    }
+}
+
+TEST_F(LinkedListOperationsTest, SpliceRange) {
+    ListType list({1, 5}, polyAlloc);
+    ListType other({10, 2, 3, 4, 20}, polyAlloc);
+
+    auto first = other.begin();
+    auto last = other.begin();
+    for (int i = 0; i < 4; ++i) {
+        ++last;
+    }
+
+    // Переносим (10, 20) = {2, 3, 4}
+    list.spliceAfter(list.begin(), other, first, last);
+
+    EXPECT_EQ(list.getSize(), 5);
+    for (int i = 0; i < 5; ++i) {
+        EXPECT_EQ(list[i].value, i + 1);
+    }
+
+    EXPECT_EQ(other.getSize(), 2);
+    EXPECT_EQ(other[0].value, 10);
+    EXPECT_EQ(other[1].value, 20);
+}
+
+TEST_F(LinkedListOperationsTest, SpliceRangeUpdatesSourceTail) {
+    ListType list(polyAlloc);
+    ListType other({1, 2, 3}, polyAlloc);
+
+    list.spliceAfter(list.beforeBegin(), other, other.begin(), other.end());
+
+    EXPECT_EQ(list.getSize(), 2);
+    EXPECT_EQ(other.getSize(), 1);
+
+    int v = 4;
+    other.pushBack(v);
+    EXPECT_EQ(other[1].value, 4);
+    EXPECT_EQ(list.popBack(), 3);
+}
+
+TEST_F(LinkedListOperationsTest, AppendRange) {
+    ListType list({1}, polyAlloc);
+    std::vector<int> values = {2, 3, 4};
+
+    list.append(values.begin(), values.end());
+
+    EXPECT_EQ(list.getSize(), 4);
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_EQ(list[i].value, i + 1);
+    }
+    EXPECT_EQ(list.popBack(), 4);
+}
+
+TEST_F(LinkedListOperationsTest, AppendEmptyRange) {
+    ListType list(polyAlloc);
+    std::vector<int> values;
+
+    list.append(values.begin(), values.end());
+
+    EXPECT_TRUE(list.isEmpty());
+}
+
+// ============ Тесты алгоритмов sort / reverse / merge / unique ============
+TEST_F(LinkedListOperationsTest, SortAscending) {
+    ListType list({5, 3, 9, 1, 7, 2, 8, 6, 4}, polyAlloc);
+
+    list.sort();
+
+    EXPECT_EQ(list.getSize(), 9);
+    for (int i = 0; i < 9; ++i) {
+        EXPECT_EQ(list[i].value, i + 1);
+    }
+
+    // Хвост должен указывать на последний узел после перевязки
+    int v = 10;
+    list.pushBack(v);
+    EXPECT_EQ(list[9].value, 10);
+}
+
+TEST_F(LinkedListOperationsTest, SortWithComparator) {
+    ListType list({1, 4, 2, 5, 3}, polyAlloc);
+
+    list.sort(std::greater<int>());
+
+    for (int i = 0; i < 5; ++i) {
+        EXPECT_EQ(list[i].value, 5 - i);
+    }
+}
+
+TEST_F(LinkedListOperationsTest, SortIsStable) {
+    using PairList = LinkedList<std::pair<int, int>, std::pmr::polymorphic_allocator<ListItem<std::pair<int, int>>>>;
+    std::pmr::polymorphic_allocator<ListItem<std::pair<int, int>>> pairAlloc{&mres};
+
+    PairList list({{2, 0}, {1, 1}, {2, 2}, {1, 3}, {0, 4}, {2, 5}}, pairAlloc);
+
+    list.sort([](const std::pair<int, int>& a, const std::pair<int, int>& b) {
+        return a.first < b.first;
+    });
+
+    std::vector<int> order;
+    for (auto it = list.begin(); it != list.end(); ++it) {
+        order.push_back((*it).second);
+    }
+
+    EXPECT_EQ(order, (std::vector<int>{4, 1, 3, 0, 2, 5}));
+}
+
+TEST_F(LinkedListOperationsTest, SortDoesNotMoveNodes) {
+    ListType list({3, 1, 2}, polyAlloc);
+    ListItem<int>* itemWithOne = &list[1];
+
+    list.sort();
+
+    EXPECT_EQ(&list[0], itemWithOne);
+}
+
+TEST_F(LinkedListOperationsTest, SortEmptyAndSingle) {
+    ListType empty(polyAlloc);
+    empty.sort();
+    EXPECT_TRUE(empty.isEmpty());
+
+    ListType single({42}, polyAlloc);
+    single.sort();
+    EXPECT_EQ(single[0].value, 42);
+}
+
+TEST_F(LinkedListOperationsTest, ReverseList) {
+    ListType list({1, 2, 3, 4}, polyAlloc);
+
+    list.reverse();
+
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_EQ(list[i].value, 4 - i);
+    }
+    EXPECT_EQ(list.popBack(), 1);
+}
+
+TEST_F(LinkedListOperationsTest, MergeSortedLists) {
+    ListType list({1, 3, 5, 7}, polyAlloc);
+    ListType other({2, 4, 6, 8, 9}, polyAlloc);
+
+    list.merge(other);
+
+    EXPECT_TRUE(other.isEmpty());
+    EXPECT_EQ(list.getSize(), 9);
+    for (int i = 0; i < 9; ++i) {
+        EXPECT_EQ(list[i].value, i + 1);
+    }
+    EXPECT_EQ(list.popBack(), 9);
+}
+
+TEST_F(LinkedListOperationsTest, MergeIntoEmpty) {
+    ListType list(polyAlloc);
+    ListType other({1, 2}, polyAlloc);
+
+    list.merge(other);
+
+    EXPECT_EQ(list.getSize(), 2);
+    EXPECT_EQ(list[1].value, 2);
+}
+
+TEST_F(LinkedListOperationsTest, UniqueRemovesConsecutiveDuplicates) {
+    ListType list({1, 1, 2, 3, 3, 3, 1, 4, 4}, polyAlloc);
+
+    size_t removed = list.unique();
+
+    EXPECT_EQ(removed, 4);
+    EXPECT_EQ(list.getSize(), 5);
+
+    std::vector<int> values;
+    for (auto it = list.begin(); it != list.end(); ++it) {
+        values.push_back(*it);
+    }
+    EXPECT_EQ(values, (std::vector<int>{1, 2, 3, 1, 4}));
+    EXPECT_EQ(list.popBack(), 4);
+}
+
+// ============ Тесты removeIf / erase ============
+TEST_F(LinkedListOperationsTest, RemoveIfHeadMiddleAndTail) {
+    ListType list({1, 2, 3, 4, 5, 6}, polyAlloc);
+
+    size_t removed = list.removeIf([](int value) { return value == 1 || value == 4 || value == 6; });
+
+    EXPECT_EQ(removed, 3);
+    EXPECT_EQ(list.getSize(), 3);
+
+    std::vector<int> values(list.begin(), std::ranges::next(list.begin(), list.end()));
+    EXPECT_EQ(values, (std::vector<int>{2, 3, 5}));
+
+    // Хвост обновлён: вставка в конец идёт после 5
+    int value = 7;
+    list.pushBack(value);
+    EXPECT_EQ(list.popBack(), 7);
+    EXPECT_EQ(list.popBack(), 5);
+}
+
+TEST_F(LinkedListOperationsTest, RemoveIfNothingAndEverything) {
+    ListType list({1, 2, 3}, polyAlloc);
+
+    EXPECT_EQ(list.removeIf([](int value) { return value > 10; }), 0);
+    EXPECT_EQ(list.getSize(), 3);
+
+    EXPECT_EQ(list.removeIf([](int) { return true; }), 3);
+    EXPECT_TRUE(list.isEmpty());
+    EXPECT_THROW(list.popBack(), std::out_of_range);
+
+    int value = 8;
+    list.pushBack(value);
+    EXPECT_EQ(list.popFront(), 8);
+}
+
+TEST_F(LinkedListOperationsTest, EraseByValue) {
+    ListType list({3, 1, 3, 3, 2, 3}, polyAlloc);
+
+    EXPECT_EQ(list.erase(3), 4);
+    EXPECT_EQ(list.erase(5), 0);
+
+    EXPECT_EQ(list.getSize(), 2);
+    EXPECT_EQ(list.popFront(), 1);
+    EXPECT_EQ(list.popFront(), 2);
+}
+
+// Исключение из предиката оставляет список согласованным
+TEST_F(LinkedListOperationsTest, RemoveIfPredicateThrows) {
+    ListType list({1, 2, 3, 4, 5}, polyAlloc);
+
+    EXPECT_THROW(list.removeIf([](int value) {
+        if (value == 4) {
+            throw std::runtime_error("predicate failed");
+        }
+        return value % 2 == 1;
+    }), std::runtime_error);
+
+    EXPECT_EQ(list.getSize(), 3);
+    EXPECT_EQ(list.popFront(), 2);
+    EXPECT_EQ(list.popFront(), 4);
+    EXPECT_EQ(list.popFront(), 5);
+}
+
+// ============ Тесты перемещающего присваивания / swap ============
+TEST_F(LinkedListOperationsTest, MoveAssignReplacesContents) {
+    ListType list({1, 2, 3}, polyAlloc);
+    ListType other({7, 8}, polyAlloc);
+
+    list = std::move(other);
+
+    EXPECT_EQ(list.getSize(), 2);
+    EXPECT_TRUE(other.isEmpty());
+    EXPECT_EQ(list.popFront(), 7);
+    EXPECT_EQ(list.popBack(), 8);
+
+    // Перемещённый список пригоден для работы
+    int value = 5;
+    other.pushBack(value);
+    EXPECT_EQ(other.popFront(), 5);
+}
+
+TEST_F(LinkedListOperationsTest, MoveAssignToSelf) {
+    ListType list({1, 2, 3}, polyAlloc);
+    ListType& alias = list;
+
+    list = std::move(alias);
+
+    EXPECT_EQ(list.getSize(), 3);
+    EXPECT_EQ(list.popBack(), 3);
+}
+
+TEST_F(LinkedListOperationsTest, MoveAssignAcrossResources) {
+    MemoryResource otherRes;
+    ListType list({1, 2}, polyAlloc);
+    ListType other({4, 5, 6}, std::pmr::polymorphic_allocator<ListItem<int>>(&otherRes));
+
+    list = std::move(other);
+
+    EXPECT_TRUE(other.isEmpty());
+    EXPECT_EQ(list.getSize(), 3);
+    EXPECT_EQ(list.popFront(), 4);
+    EXPECT_EQ(list.popBack(), 6);
+}
+
+TEST_F(LinkedListOperationsTest, SwapLists) {
+    ListType left({1, 2, 3}, polyAlloc);
+    ListType right({9}, polyAlloc);
+
+    left.swap(right);
+
+    EXPECT_EQ(left.getSize(), 1);
+    EXPECT_EQ(right.getSize(), 3);
+    EXPECT_EQ(left.popFront(), 9);
+    EXPECT_EQ(right.popBack(), 3);
+
+    std::ranges::swap(left, right);
+    EXPECT_EQ(left.getSize(), 2);
+    EXPECT_TRUE(right.isEmpty());
+}
+
+TEST_F(LinkedListOperationsTest, SwapAcrossResourcesKeepsAllocators) {
+    MemoryResource otherRes;
+    std::pmr::polymorphic_allocator<ListItem<int>> otherAlloc(&otherRes);
+    ListType left({1, 2, 3}, polyAlloc);
+    ListType right({8, 9}, otherAlloc);
+
+    swap(left, right);
+
+    EXPECT_EQ(left.getSize(), 2);
+    EXPECT_EQ(right.getSize(), 3);
+    EXPECT_EQ(left.popFront(), 8);
+    EXPECT_EQ(right.popFront(), 1);
+
+    // Узлы перенесены в ресурсы своих списков
+    ListType sameAsLeft(polyAlloc);
+    sameAsLeft.spliceAfter(sameAsLeft.beforeBegin(), left);
+    EXPECT_EQ(sameAsLeft.popFront(), 9);
+}
+
+// ============ Тесты emplace ============
+TEST_F(LinkedListOperationsTest, EmplaceFrontAndBack) {
+    ListType list(polyAlloc);
+
+    list.emplaceBack(2);
+    list.emplaceFront(1);
+    int& back = list.emplaceBack(3);
+    back = 4;
+
+    EXPECT_EQ(list.getSize(), 3);
+    EXPECT_EQ(list.popFront(), 1);
+    EXPECT_EQ(list.popFront(), 2);
+    EXPECT_EQ(list.popFront(), 4);
+}
+
+TEST_F(LinkedListOperationsTest, PushRvalues) {
+    std::pmr::polymorphic_allocator<ListItem<std::string>> stringAlloc(&mres);
+    LinkedList<std::string, std::pmr::polymorphic_allocator<ListItem<std::string>>> list(stringAlloc);
+
+    std::string value = "moved";
+    list.pushBack(std::move(value));
+    list.pushFront(std::string("first"));
+
+    EXPECT_EQ(list.popFront(), "first");
+    EXPECT_EQ(list.popFront(), "moved");
+}
+
+// ============ Тесты ranges ============
+static_assert(std::forward_iterator<LinkedList<int, std::pmr::polymorphic_allocator<ListItem<int>>>::iterator>);
+static_assert(std::forward_iterator<LinkedList<int, std::pmr::polymorphic_allocator<ListItem<int>>>::const_iterator>);
+static_assert(std::ranges::forward_range<LinkedList<int, std::pmr::polymorphic_allocator<ListItem<int>>>>);
+static_assert(std::ranges::forward_range<const LinkedList<int, std::pmr::polymorphic_allocator<ListItem<int>>>>);
+static_assert(std::ranges::sized_range<LinkedList<int, std::pmr::polymorphic_allocator<ListItem<int>>>>);
+
+TEST_F(LinkedListOperationsTest, RangesSizeAndAlgorithms) {
+    ListType list({5, 1, 4, 2, 3}, polyAlloc);
+
+    EXPECT_EQ(std::ranges::size(list), 5);
+    EXPECT_EQ(std::ranges::distance(list), 5);
+    EXPECT_EQ(*std::ranges::max_element(list), 5);
+    EXPECT_EQ(std::ranges::count_if(list, [](int value) { return value % 2 == 0; }), 2);
+    EXPECT_NE(std::ranges::find(list, 4), list.end());
+    EXPECT_EQ(std::ranges::find(list, 7), list.end());
+}
+
+TEST_F(LinkedListOperationsTest, LazyViewPipeline) {
+    ListType list({1, 2, 3, 4, 5, 6, 7, 8}, polyAlloc);
+
+    auto view = list
+        | std::views::filter([](int value) { return value % 2 == 0; })
+        | std::views::transform([](int value) { return value * 10; })
+        | std::views::take(3);
+
+    std::vector<int> result;
+    std::ranges::copy(view, std::back_inserter(result));
+
+    EXPECT_EQ(result, (std::vector<int>{20, 40, 60}));
+}
+
+TEST_F(LinkedListOperationsTest, ConstIteration) {
+    ListType list({1, 2, 3}, polyAlloc);
+    const ListType& constList = list;
+
+    int sum = 0;
+    for (const int& value : constList) {
+        sum += value;
+    }
+    EXPECT_EQ(sum, 6);
+
+    ListType::const_iterator it = list.begin();
+    static_assert(std::is_same_v<decltype(*it), const int&>);
+    EXPECT_EQ(*it, 1);
+    EXPECT_EQ(*std::ranges::next(constList.begin()), 2);
+}
+
+TEST_F(LinkedListOperationsTest, ViewsModifyThroughReferences) {
+    ListType list({1, 2, 3, 4}, polyAlloc);
+
+    for (int& value : list | std::views::drop(2)) {
+        value *= 100;
+    }
+
+    EXPECT_EQ(list[2].value, 300);
+    EXPECT_EQ(list[3].value, 400);
+}
+
+TEST_F(LinkedListOperationsTest, AppendMaterializesView) {
+    ListType source({1, 2, 3, 4, 5}, polyAlloc);
+    ListType target(polyAlloc);
+
+    target.append(source | std::views::filter([](int value) { return value > 2; }));
+
+    EXPECT_EQ(target.getSize(), 3);
+    EXPECT_EQ(target.popFront(), 3);
+    EXPECT_EQ(target.popFront(), 4);
+    EXPECT_EQ(target.popFront(), 5);
+}
+
+// ============ Тесты clone ============
+TEST_F(LinkedListOperationsTest, CloneCopiesValues) {
+    ListType list({1, 2, 3}, polyAlloc);
+
+    ListType copy = list.clone();
+    int v4 = 4;
+    copy.pushBack(v4);
+    list[0].value = 10;
+
+    EXPECT_EQ(list.getSize(), 3);
+    EXPECT_EQ(copy.getSize(), 4);
+    EXPECT_EQ(copy[0].value, 1);
+    EXPECT_EQ(copy[2].value, 3);
+    EXPECT_EQ(copy.popBack(), 4);
+    EXPECT_EQ(copy.popBack(), 3);
+}
+
+TEST_F(LinkedListOperationsTest, CloneToOtherResource) {
+    using StringList = LinkedList<std::string, std::pmr::polymorphic_allocator<ListItem<std::string>>>;
+    StringList list({"a", "b"}, &mres);
+
+    MemoryResource otherRes;
+    StringList copy = list.clone(&otherRes);
+
+    EXPECT_EQ(copy[1].value, "b");
+    list.popFront();
+    EXPECT_EQ(copy.popFront(), "a");
+}
+
+TEST_F(LinkedListOperationsTest, CloneEmpty) {
+    ListType list(polyAlloc);
+    ListType copy = list.clone();
+
+    EXPECT_EQ(copy.getSize(), 0);
+}
+
+// ============ Тесты clear ============
+TEST_F(LinkedListOperationsTest, ClearAndReuse) {
+    ListType list({1, 2, 3}, polyAlloc);
+
+    list.clear();
+
+    EXPECT_EQ(list.getSize(), 0);
+    EXPECT_THROW(list.popFront(), std::out_of_range);
+
+    int value = 5;
+    list.pushBack(value);
+    list.pushFront(value);
+    EXPECT_EQ(list.getSize(), 2);
+    EXPECT_EQ(list.popBack(), 5);
+}
+
+// ============ Тесты обхода с предвыборкой ============
+TEST_F(LinkedListOperationsTest, ForEachVisitsInOrder) {
+    ListType list({1, 2, 3, 4, 5}, polyAlloc);
+
+    for (size_t distance : {size_t(0), size_t(1), size_t(3), size_t(100)}) {
+        std::vector<int> values;
+        list.forEach([&values](int value) { values.push_back(value); }, distance);
+
+        EXPECT_EQ(values, (std::vector<int>{1, 2, 3, 4, 5}));
+    }
+}
+
+TEST_F(LinkedListOperationsTest, ForEachCanModify) {
+    ListType list({1, 2, 3}, polyAlloc);
+
+    list.forEach([](int& value) { value *= 10; });
+
+    EXPECT_EQ(list[2].value, 30);
+}
+
+TEST_F(LinkedListOperationsTest, PrefetchIteratorMatchesIterator) {
+    ListType list({4, 5, 6}, polyAlloc);
+    std::vector<int> values;
+
+    for (auto it = list.prefetchBegin(2); it != list.prefetchEnd(); ++it) {
+        values.push_back(*it);
+    }
+
+    EXPECT_EQ(values, (std::vector<int>{4, 5, 6}));
+    EXPECT_THROW(*list.prefetchEnd(), std::out_of_range);
+
+    ListType empty(polyAlloc);
+    EXPECT_TRUE(empty.prefetchBegin() == empty.prefetchEnd());
+}
+
+TEST_F(LinkedListOperationsTest, ForEachWithJumpTable) {
+    ListType list(polyAlloc);
+    for (int i = 0; i < 23; ++i) {
+        list.pushBack(i);
+    }
+
+    auto table = list.makeJumpTable(4);
+    EXPECT_EQ(table.items.size(), 6);
+
+    for (size_t lanes : {size_t(1), size_t(2), size_t(4), size_t(50)}) {
+        std::vector<int> values;
+        list.forEach([&values](int value) { values.push_back(value); }, table, lanes);
+
+        ASSERT_EQ(values.size(), 23);
+        for (int i = 0; i < 23; ++i) {
+            EXPECT_EQ(values[i], i);
+        }
+    }
+}
+
+TEST_F(LinkedListOperationsTest, JumpTableOfEmptyList) {
+    ListType list(polyAlloc);
+    auto table = list.makeJumpTable();
+    size_t calls = 0;
+
+    list.forEach([&calls](int) { ++calls; }, table);
+
+    EXPECT_TRUE(table.items.empty());
+    EXPECT_EQ(calls, 0);
+}
@@ -0,0 +1,446 @@
+#include <gtest/gtest.h>
+#include "../include/LinkedList.hpp"
+#include "../include/ListSerialization.hpp"
+#include "counting_resource.hpp"
+
+#include <algorithm>
+#include <memory_resource>
+#include <sstream>
+#include <string>
+#include <utility>
+
+struct Order {
+    int id;
+    double amount;
+};
+
+struct Student {
+    std::string name;
+    int group;
+};
+
+// Ключ - функциональный объект без состояния
+struct StudentName {
+    const std::string& operator()(const Student& student) const {
+        return student.name;
+    }
+};
+
+template <typename ListType>
+concept SearchableById = requires(ListType& list) { list.find(1); };
+
+// Тесты хеш-индекса по ключу
+class ListIndexTest : public ::testing::Test {
+protected:
+    CountingResource countingRes;
+    std::pmr::polymorphic_allocator<ListItem<Order>> orderAlloc{&countingRes};
+
+    using OrderList = LinkedList<Order, std::pmr::polymorphic_allocator<ListItem<Order>>, PerNodeAllocation, HashIndex<&Order::id>>;
+    using SlabOrderList = LinkedList<Order, std::pmr::polymorphic_allocator<ListItem<Order>>, SlabAllocation, HashIndex<&Order::id>>;
+    using InlineOrderList = LinkedList<Order, std::pmr::polymorphic_allocator<ListItem<Order>>, InlineAllocation<4>, HashIndex<&Order::id>>;
+    using StudentList = LinkedList<Student, std::allocator<ListItem<Student>>, PerNodeAllocation, HashIndex<StudentName{}>>;
+    using InlineStudentList = LinkedList<Student, std::allocator<ListItem<Student>>, InlineAllocation<4>, HashIndex<&Student::name>>;
+
+    template <typename ListType>
+    static void fill(ListType& list, int count) {
+        for (int i = 0; i < count; ++i) {
+            list.pushBack(Order{i, i * 1.5});
+        }
+    }
+
+    // Каждый элемент списка находится по своему ключу
+    template <typename ListType>
+    static void expectIndexed(ListType& list) {
+        for (auto& order : list) {
+            EXPECT_EQ(list.find(order.id), &order);
+        }
+    }
+};
+
+// ============ Поиск ============
+TEST_F(ListIndexTest, FindAfterPush) {
+    OrderList list(orderAlloc);
+    this->fill(list, 100);
+    list.pushFront(Order{-1, 0.0});
+
+    ASSERT_NE(list.find(42), nullptr);
+    EXPECT_DOUBLE_EQ(list.find(42)->amount, 63.0);
+    EXPECT_EQ(list.find(-1), &*list.begin());
+    this->expectIndexed(list);
+}
+
+TEST_F(ListIndexTest, MissingKeyReturnsNull) {
+    OrderList list(orderAlloc);
+    EXPECT_EQ(list.find(1), nullptr);
+
+    this->fill(list, 10);
+    EXPECT_EQ(list.find(10), nullptr);
+    EXPECT_EQ(list.find(-5), nullptr);
+}
+
+TEST_F(ListIndexTest, ConstFind) {
+    OrderList list(orderAlloc);
+    this->fill(list, 5);
+
+    const OrderList& constList = list;
+    const Order* order = constList.find(3);
+    ASSERT_NE(order, nullptr);
+    EXPECT_EQ(order->id, 3);
+}
+
+TEST_F(ListIndexTest, FunctorKey) {
+    StudentList list;
+    list.emplaceBack("Ivanov", 1);
+    list.emplaceBack("Petrov", 2);
+    list.emplaceFront("Sidorov", 3);
+
+    ASSERT_NE(list.find("Petrov"), nullptr);
+    EXPECT_EQ(list.find("Petrov")->group, 2);
+    EXPECT_EQ(list.find("Sidorov")->group, 3);
+    EXPECT_EQ(list.find("Smirnov"), nullptr);
+}
+
+// ============ Удаление ============
+TEST_F(ListIndexTest, PopRemovesFromIndex) {
+    OrderList list(orderAlloc);
+    this->fill(list, 10);
+
+    list.popFront();
+    list.popBack();
+
+    EXPECT_EQ(list.find(0), nullptr);
+    EXPECT_EQ(list.find(9), nullptr);
+    this->expectIndexed(list);
+}
+
+TEST_F(ListIndexTest, EraseAfterRemovesFromIndex) {
+    OrderList list(orderAlloc);
+    this->fill(list, 10);
+
+    auto it = list.begin();
+    ++it;
+    list.eraseAfter(it);
+
+    EXPECT_EQ(list.find(2), nullptr);
+    EXPECT_EQ(list.getSize(), 9);
+    this->expectIndexed(list);
+}
+
+TEST_F(ListIndexTest, UniqueRemovesFromIndex) {
+    OrderList list(orderAlloc);
+    for (int i = 0; i < 10; ++i) {
+        list.pushBack(Order{i, static_cast<double>(i / 2)});
+    }
+
+    list.unique([](const Order& left, const Order& right) { return left.amount == right.amount; });
+
+    EXPECT_EQ(list.getSize(), 5);
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_EQ(list.find(i) != nullptr, i % 2 == 0);
+    }
+}
+
+TEST_F(ListIndexTest, RemoveIfRemovesFromIndex) {
+    OrderList list(orderAlloc);
+    this->fill(list, 100);
+
+    list.removeIf([](const Order& order) { return order.id % 3 == 0; });
+
+    EXPECT_EQ(list.find(0), nullptr);
+    EXPECT_EQ(list.find(99), nullptr);
+    EXPECT_NE(list.find(98), nullptr);
+    this->expectIndexed(list);
+}
+
+// Слоты удалённых узлов переиспользуются: таблица не растёт при чередовании
+TEST_F(ListIndexTest, QueueChurnKeepsIndexSmall) {
+    OrderList list(orderAlloc);
+    this->fill(list, 8);
+    size_t allocationsBefore = countingRes.allocations;
+
+    for (int i = 8; i < 10000; ++i) {
+        list.popFront();
+        list.pushBack(Order{i, 0.0});
+    }
+
+    EXPECT_LT(countingRes.allocations - allocationsBefore, 2 * (10000 - 8) + 100);
+    EXPECT_EQ(list.find(7), nullptr);
+    EXPECT_NE(list.find(9999), nullptr);
+    this->expectIndexed(list);
+}
+
+// ============ Равные ключи ============
+// Элемент, найденный по ключу, принадлежит списку
+template <typename ListType>
+static bool foundInList(ListType& list, int id) {
+    const Order* found = list.find(id);
+    if (found == nullptr || found->id != id) {
+        return false;
+    }
+
+    return std::ranges::any_of(list, [found](const Order& order) { return &order == found; });
+}
+
+TEST_F(ListIndexTest, DuplicateKeysFormGroup) {
+    OrderList list(orderAlloc);
+    for (int i = 0; i < 5; ++i) {
+        list.pushBack(Order{7, static_cast<double>(i)});
+        list.pushBack(Order{i, -1.0});
+    }
+
+    EXPECT_TRUE(foundInList(list, 7));
+
+    list.popFront();
+    EXPECT_TRUE(foundInList(list, 7));
+
+    EXPECT_EQ(list.removeIf([](const Order& order) { return order.id == 7 && order.amount < 4.0; }), 3);
+    ASSERT_TRUE(foundInList(list, 7));
+    EXPECT_DOUBLE_EQ(list.find(7)->amount, 4.0);
+
+    list.removeIf([](const Order& order) { return order.id == 7; });
+    EXPECT_EQ(list.find(7), nullptr);
+    this->expectIndexed(list);
+}
+
+TEST_F(ListIndexTest, DuplicateKeysSurviveInlineRelocation) {
+    InlineOrderList source(orderAlloc);
+    for (int i = 0; i < 4; ++i) {
+        source.pushBack(Order{1, static_cast<double>(i)});
+    }
+
+    InlineOrderList moved(std::move(source));
+    EXPECT_EQ(source.find(1), nullptr);
+
+    // После переноса индекс указывает на новые узлы всей группы
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_TRUE(foundInList(moved, 1));
+        moved.popFront();
+    }
+    EXPECT_EQ(moved.find(1), nullptr);
+}
+
+TEST_F(ListIndexTest, SpliceMovesDuplicateGroup) {
+    OrderList target(orderAlloc);
+    OrderList source(orderAlloc);
+    target.pushBack(Order{3, 0.0});
+    for (int i = 1; i <= 3; ++i) {
+        source.pushBack(Order{3, static_cast<double>(i)});
+    }
+
+    target.spliceAfter(target.beforeBegin(), source);
+    EXPECT_EQ(source.find(3), nullptr);
+
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_TRUE(foundInList(target, 3));
+        target.popBack();
+    }
+    EXPECT_EQ(target.find(3), nullptr);
+}
+
+// ============ Перенос узлов между списками ============
+TEST_F(ListIndexTest, SpliceMovesIndexEntries) {
+    OrderList target(orderAlloc);
+    OrderList source(orderAlloc);
+    this->fill(source, 20);
+
+    target.spliceAfter(target.beforeBegin(), source);
+
+    EXPECT_EQ(source.find(5), nullptr);
+    ASSERT_NE(target.find(5), nullptr);
+    this->expectIndexed(target);
+}
+
+TEST_F(ListIndexTest, SpliceAcrossResourcesIndexesCopies) {
+    std::pmr::unsynchronized_pool_resource otherPool;
+    std::pmr::polymorphic_allocator<ListItem<Order>> otherAlloc(&otherPool);
+    OrderList target(orderAlloc);
+    OrderList source(otherAlloc);
+    this->fill(source, 20);
+
+    target.spliceAfter(target.beforeBegin(), source);
+
+    EXPECT_EQ(source.find(5), nullptr);
+    this->expectIndexed(target);
+}
+
+TEST_F(ListIndexTest, SpliceRangeMovesIndexEntries) {
+    SlabOrderList target(orderAlloc);
+    SlabOrderList source(orderAlloc);
+    this->fill(source, 10);
+
+    auto first = source.begin();
+    auto last = std::ranges::next(source.begin(), 5);
+    target.spliceAfter(target.beforeBegin(), source, first, last);
+
+    EXPECT_EQ(target.getSize(), 4);
+    for (int i = 1; i <= 4; ++i) {
+        EXPECT_NE(target.find(i), nullptr);
+        EXPECT_EQ(source.find(i), nullptr);
+    }
+    this->expectIndexed(target);
+    this->expectIndexed(source);
+}
+
+// Встроенные узлы переносятся по значению: индекс указывает на новые узлы
+TEST_F(ListIndexTest, InlineMoveUpdatesIndex) {
+    InlineOrderList source(orderAlloc);
+    this->fill(source, 6);
+
+    InlineOrderList moved(std::move(source));
+
+    EXPECT_EQ(source.find(2), nullptr);
+    this->expectIndexed(moved);
+}
+
+TEST_F(ListIndexTest, InlineSpliceUpdatesIndex) {
+    InlineOrderList target(orderAlloc);
+    {
+        InlineOrderList source(orderAlloc);
+        this->fill(source, 6);
+        target.spliceAfter(target.beforeBegin(), source);
+    }
+
+    EXPECT_EQ(target.getSize(), 6);
+    this->expectIndexed(target);
+}
+
+// Строковый ключ: при переносе значения ключ старого узла становится пустым
+TEST_F(ListIndexTest, InlineMoveUpdatesStringKeys) {
+    InlineStudentList source;
+    source.pushBack(Student{"Ivanov", 1});
+    source.pushBack(Student{"Petrov", 2});
+    source.pushBack(Student{"Ivanov", 3});
+
+    InlineStudentList moved(std::move(source));
+    EXPECT_EQ(source.find("Ivanov"), nullptr);
+    ASSERT_NE(moved.find("Petrov"), nullptr);
+    EXPECT_EQ(moved.find("Petrov")->group, 2);
+
+    InlineStudentList target;
+    target.spliceAfter(target.beforeBegin(), moved);
+    EXPECT_EQ(target.find("Petrov"), &target[1].value);
+
+    for (int i = 0; i < 2; ++i) {
+        Student* found = target.find("Ivanov");
+        ASSERT_NE(found, nullptr);
+        EXPECT_EQ(found->name, "Ivanov");
+
+        int group = found->group;
+        EXPECT_EQ(target.removeIf([group](const Student& student) { return student.group == group; }), 1);
+    }
+    EXPECT_EQ(target.find("Ivanov"), nullptr);
+    EXPECT_EQ(target.getSize(), 1);
+}
+
+TEST_F(ListIndexTest, SwapExchangesIndexes) {
+    OrderList left(orderAlloc);
+    OrderList right(orderAlloc);
+    this->fill(left, 10);
+    right.pushBack(Order{100, 1.0});
+
+    left.swap(right);
+
+    EXPECT_NE(left.find(100), nullptr);
+    EXPECT_EQ(left.find(5), nullptr);
+    EXPECT_NE(right.find(5), nullptr);
+    this->expectIndexed(left);
+    this->expectIndexed(right);
+}
+
+TEST_F(ListIndexTest, MoveAssignAcrossResourcesReindexes) {
+    std::pmr::unsynchronized_pool_resource otherPool;
+    OrderList list(orderAlloc);
+    OrderList other{std::pmr::polymorphic_allocator<ListItem<Order>>(&otherPool)};
+    this->fill(list, 3);
+    this->fill(other, 20);
+
+    list = std::move(other);
+
+    EXPECT_EQ(list.getSize(), 20);
+    EXPECT_EQ(other.find(1), nullptr);
+    this->expectIndexed(list);
+}
+
+// ============ Создание списков ============
+TEST_F(ListIndexTest, CloneHasOwnIndex) {
+    SlabOrderList list(orderAlloc);
+    this->fill(list, 50);
+
+    SlabOrderList copy = list.clone();
+
+    EXPECT_NE(copy.find(10), list.find(10));
+    this->expectIndexed(copy);
+    this->expectIndexed(list);
+}
+
+TEST_F(ListIndexTest, AppendIndexesRange) {
+    SlabOrderList list(orderAlloc);
+    std::vector<Order> orders = {{1, 1.0}, {2, 2.0}, {3, 3.0}};
+
+    list.append(orders);
+
+    EXPECT_EQ(list.find(2)->amount, 2.0);
+    this->expectIndexed(list);
+}
+
+TEST_F(ListIndexTest, LoadedListIsIndexed) {
+    std::stringstream stream(std::ios::in | std::ios::out | std::ios::binary);
+    OrderList source(orderAlloc);
+    this->fill(source, 30);
+
+    saveList(source, stream);
+    auto restored = loadList<OrderList>(stream, orderAlloc);
+
+    ASSERT_NE(restored.find(17), nullptr);
+    EXPECT_DOUBLE_EQ(restored.find(17)->amount, 25.5);
+    this->expectIndexed(restored);
+}
+
+TEST_F(ListIndexTest, RebuildAfterKeyChange) {
+    OrderList list(orderAlloc);
+    this->fill(list, 5);
+
+    for (auto& order : list) {
+        order.id += 100;
+    }
+    list.rebuildIndex();
+
+    EXPECT_EQ(list.find(1), nullptr);
+    EXPECT_EQ(list.find(101)->amount, 1.5);
+    this->expectIndexed(list);
+}
+
+// ============ Память индекса ============
+TEST_F(ListIndexTest, IndexUsesListResource) {
+    {
+        OrderList list(orderAlloc);
+        this->fill(list, 100);
+
+        EXPECT_GT(countingRes.allocations, 100);
+    }
+
+    EXPECT_EQ(countingRes.allocations, countingRes.deallocations);
+}
+
+TEST_F(ListIndexTest, ClearReleasesIndex) {
+    OrderList list(orderAlloc);
+    this->fill(list, 100);
+
+    list.clear();
+
+    EXPECT_EQ(countingRes.allocations, countingRes.deallocations);
+    EXPECT_EQ(list.find(1), nullptr);
+
+    list.pushBack(Order{1, 1.0});
+    EXPECT_NE(list.find(1), nullptr);
+}
+
+// Без индекса поиск по ключу недоступен
+TEST_F(ListIndexTest, NoIndexHasNoFind) {
+    using PlainList = LinkedList<Order, std::pmr::polymorphic_allocator<ListItem<Order>>>;
+    using ExplicitList = LinkedList<Order, std::pmr::polymorphic_allocator<ListItem<Order>>, PerNodeAllocation, NoIndex>;
+
+    static_assert(std::is_same_v<PlainList, ExplicitList>);
+    static_assert(!SearchableById<PlainList>);
+    static_assert(SearchableById<OrderList>);
+}
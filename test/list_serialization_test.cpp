@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+#include "../include/LinkedList.hpp"
+#include "../include/ListSerialization.hpp"
+#include "counting_resource.hpp"
+
+#include <cstddef>
+#include <cstring>
+#include <memory_resource>
+#include <sstream>
+#include <string>
+
+struct Point3D {
+    double x, y, z;
+};
+
+// Тесты двоичного сохранения и загрузки списка
+class ListSerializationTest : public ::testing::Test {
+protected:
+    CountingResource countingRes;
+    std::stringstream stream{std::ios::in | std::ios::out | std::ios::binary};
+
+    template <typename T>
+    using SlabList = LinkedList<T, std::pmr::polymorphic_allocator<ListItem<T>>, SlabAllocation>;
+};
+
+TEST_F(ListSerializationTest, RoundTripInts) {
+    SlabList<int> source(&countingRes);
+    for (int i = 0; i < 100000; ++i) {
+        source.pushBack(i);
+    }
+
+    saveList(source, stream);
+
+    CountingResource targetRes;
+    auto restored = loadList<SlabList<int>>(stream, std::pmr::polymorphic_allocator<ListItem<int>>(&targetRes));
+
+    ASSERT_EQ(restored.getSize(), 100000);
+    EXPECT_EQ(targetRes.allocations, 1);
+
+    int expected = 0;
+    for (auto it = restored.begin(); it != restored.end(); ++it) {
+        EXPECT_EQ(*it, expected++);
+    }
+}
+
+TEST_F(ListSerializationTest, RoundTripStructs) {
+    SlabList<Point3D> source({{1, 2, 3}, {4, 5, 6}}, &countingRes);
+
+    saveList(source, stream);
+    auto restored = loadList<SlabList<Point3D>>(stream, std::pmr::polymorphic_allocator<ListItem<Point3D>>(&countingRes));
+
+    ASSERT_EQ(restored.getSize(), 2);
+    EXPECT_EQ(restored[1].value.y, 5.0);
+}
+
+TEST_F(ListSerializationTest, RoundTripStringsThroughCodec) {
+    LinkedList<std::string, std::pmr::polymorphic_allocator<ListItem<std::string>>> source({"Hello", "", "LinkedList"}, &countingRes);
+
+    saveList(source, stream);
+    auto restored = loadList<decltype(source)>(stream, std::pmr::polymorphic_allocator<ListItem<std::string>>(&countingRes));
+
+    ASSERT_EQ(restored.getSize(), 3);
+    EXPECT_EQ(restored[0].value, "Hello");
+    EXPECT_EQ(restored[1].value, "");
+    EXPECT_EQ(restored[2].value, "LinkedList");
+}
+
+TEST_F(ListSerializationTest, EmptyList) {
+    SlabList<int> source(&countingRes);
+
+    saveList(source, stream);
+    auto restored = loadList<SlabList<int>>(stream, std::pmr::polymorphic_allocator<ListItem<int>>(&countingRes));
+
+    EXPECT_TRUE(restored.getSize() == 0);
+}
+
+// ============ Тесты ошибок ============
+TEST_F(ListSerializationTest, RejectsForeignData) {
+    stream << "definitely not a serialized list";
+
+    EXPECT_THROW(
+        (loadList<SlabList<int>>(stream, std::pmr::polymorphic_allocator<ListItem<int>>(&countingRes))),
+        std::runtime_error
+    );
+}
+
+TEST_F(ListSerializationTest, RejectsMismatchedElementType) {
+    SlabList<int> source({1, 2}, &countingRes);
+    saveList(source, stream);
+
+    EXPECT_THROW(
+        (loadList<SlabList<double>>(stream, std::pmr::polymorphic_allocator<ListItem<double>>(&countingRes))),
+        std::runtime_error
+    );
+}
+
+TEST_F(ListSerializationTest, RejectsTruncatedStream) {
+    SlabList<int> source({1, 2, 3}, &countingRes);
+    saveList(source, stream);
+
+    std::string data = stream.str();
+    std::stringstream truncated(data.substr(0, data.size() - 2), std::ios::in | std::ios::binary);
+
+    EXPECT_THROW(
+        (loadList<SlabList<int>>(truncated, std::pmr::polymorphic_allocator<ListItem<int>>(&countingRes))),
+        std::runtime_error
+    );
+}
+
+// Число элементов из заголовка не выделяется, если данных под него нет
+TEST_F(ListSerializationTest, RejectsCountBeyondStream) {
+    SlabList<int> source({1, 2, 3}, &countingRes);
+    saveList(source, stream);
+
+    std::string data = stream.str();
+    uint64_t count = uint64_t(1) << 40;
+    std::memcpy(data.data() + offsetof(ListSerializationDetail::Header, count), &count, sizeof(count));
+    std::stringstream corrupted(data, std::ios::in | std::ios::binary);
+
+    EXPECT_THROW(
+        (loadList<SlabList<int>>(corrupted, std::pmr::polymorphic_allocator<ListItem<int>>(&countingRes))),
+        std::runtime_error
+    );
+    EXPECT_EQ(countingRes.allocations, 1);
+}
+
+TEST_F(ListSerializationTest, RejectsStringLengthBeyondStream) {
+    SlabList<std::string> source({"alpha", "beta"}, &countingRes);
+    saveList(source, stream);
+
+    std::string data = stream.str();
+    uint64_t length = uint64_t(1) << 40;
+    std::memcpy(data.data() + sizeof(ListSerializationDetail::Header), &length, sizeof(length));
+    std::stringstream corrupted(data, std::ios::in | std::ios::binary);
+
+    EXPECT_THROW(
+        (loadList<SlabList<std::string>>(corrupted, std::pmr::polymorphic_allocator<ListItem<std::string>>(&countingRes))),
+        std::runtime_error
+    );
+}
@@ -90,3 +90,32 @@ TEST_F(MemoryResourceTest, DeallocateUnallocatedMemory) {
     char dummy[100];
     EXPECT_THROW(mres.do_deallocate(&dummy, 100, 1), std::logic_error);
 }
+
+TEST_F(MemoryResourceTest, DeallocateBatch) {
+    void* ptr1 = mres.do_allocate(100, 1);
+    void* ptr2 = mres.do_allocate(100, 1);
+    void* ptr3 = mres.do_allocate(100, 1);
+    void* ptr4 = mres.do_allocate(100, 1);
+
+    // Порядок адресов в пакете произвольный
+    void* batch[] = {ptr3, ptr1};
+    mres.deallocateBatch(batch, 2, 100, 1);
+
+    EXPECT_EQ(mres.do_allocate(100, 1), ptr1);
+    EXPECT_EQ(mres.do_allocate(100, 1), ptr3);
+
+    void* rest[] = {ptr4, ptr2};
+    mres.deallocateBatch(rest, 2, 100, 1);
+    EXPECT_EQ(mres.do_allocate(100, 1), ptr2);
+}
+
+TEST_F(MemoryResourceTest, DeallocateBatchWithUnallocatedMemory) {
+    void* ptr1 = mres.do_allocate(100, 1);
+    char dummy[100];
+
+    void* batch[] = {ptr1, &dummy};
+    EXPECT_THROW(mres.deallocateBatch(batch, 2, 100, 1), std::logic_error);
+
+    // Пакет с ошибкой не освобождает ничего
+    EXPECT_NE(mres.do_allocate(100, 1), ptr1);
+}
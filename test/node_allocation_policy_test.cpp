@@ -0,0 +1,815 @@
+#include <gtest/gtest.h>
+#include "../include/LinkedList.hpp"
+#include "../include/MemoryResource.hpp"
+#include "counting_resource.hpp"
+
+#include <memory_resource>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Ресурс, считающий пакетные освобождения
+class BatchCountingResource : public BatchMemoryResource {
+public:
+    size_t batches = 0;
+    size_t deallocations = 0;
+
+protected:
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* ptr, size_t bytes, size_t alignment) override {
+        ++this->deallocations;
+        std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+    }
+
+    void do_deallocate_batch(void** ptrs, size_t count, size_t bytes, size_t alignment) override {
+        ++this->batches;
+        for (size_t i = 0; i < count; ++i) {
+            std::pmr::new_delete_resource()->deallocate(ptrs[i], bytes, alignment);
+        }
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+};
+
+// Тесты политик выделения узлов
+class NodeAllocationPolicyTest : public ::testing::Test {
+protected:
+    CountingResource countingRes;
+    std::pmr::polymorphic_allocator<ListItem<int>> countingAlloc{&countingRes};
+
+    using SlabList = LinkedList<int, std::pmr::polymorphic_allocator<ListItem<int>>, SlabAllocation>;
+    using PerNodeList = LinkedList<int, std::pmr::polymorphic_allocator<ListItem<int>>, PerNodeAllocation>;
+    using InlineList = LinkedList<int, std::pmr::polymorphic_allocator<ListItem<int>>, InlineAllocation<4>>;
+    using InlineSlabList = LinkedList<int, std::pmr::polymorphic_allocator<ListItem<int>>, InlineAllocation<4, SlabAllocation>>;
+    using RecyclingList = LinkedList<int, std::pmr::polymorphic_allocator<ListItem<int>>, RecyclingAllocation<16>>;
+    using RecyclingPerNodeList = LinkedList<int, std::pmr::polymorphic_allocator<ListItem<int>>, RecyclingAllocation<4, PerNodeAllocation>>;
+
+    template <typename ListType>
+    static std::vector<int> toVector(ListType& list) {
+        std::vector<int> values;
+        std::ranges::copy(list, std::back_inserter(values));
+        return values;
+    }
+
+    template <typename ListType>
+    static std::vector<std::string> toStrings(ListType& list) {
+        std::vector<std::string> values;
+        std::ranges::copy(list, std::back_inserter(values));
+        return values;
+    }
+};
+
+// ============ Пакетное выделение ============
+TEST_F(NodeAllocationPolicyTest, SizeConstructorSingleAllocation) {
+    {
+        SlabList list(100, countingAlloc);
+
+        EXPECT_EQ(list.getSize(), 100);
+        EXPECT_EQ(countingRes.allocations, 1);
+    }
+
+    EXPECT_EQ(countingRes.deallocations, 1);
+}
+
+TEST_F(NodeAllocationPolicyTest, InitializerListContiguousLayout) {
+    SlabList list({1, 2, 3, 4, 5}, countingAlloc);
+
+    EXPECT_EQ(countingRes.allocations, 1);
+    for (size_t i = 1; i < list.getSize(); ++i) {
+        EXPECT_EQ(&list[i], &list[i - 1] + 1);
+        EXPECT_EQ(list[i].value, static_cast<int>(i) + 1);
+    }
+}
+
+TEST_F(NodeAllocationPolicyTest, AppendRangeSingleAllocation) {
+    SlabList list(countingAlloc);
+    std::vector<int> values(50, 7);
+
+    list.append(values.begin(), values.end());
+
+    EXPECT_EQ(list.getSize(), 50);
+    EXPECT_EQ(countingRes.allocations, 1);
+}
+
+TEST_F(NodeAllocationPolicyTest, PerNodeAllocatesEachNode) {
+    PerNodeList list({1, 2, 3, 4, 5}, countingAlloc);
+
+    EXPECT_EQ(countingRes.allocations, 5);
+}
+
+// ============ Совместимость с pushFront / popFront ============
+TEST_F(NodeAllocationPolicyTest, PopFromBatchKeepsSlabUntilEmpty) {
+    SlabList list({1, 2, 3}, countingAlloc);
+
+    EXPECT_EQ(list.popFront(), 1);
+    EXPECT_EQ(list.popBack(), 3);
+    EXPECT_EQ(countingRes.deallocations, 0);
+
+    EXPECT_EQ(list.popFront(), 2);
+    EXPECT_EQ(countingRes.deallocations, 1);
+}
+
+TEST_F(NodeAllocationPolicyTest, PushIntoBatchList) {
+    {
+        SlabList list({2, 3}, countingAlloc);
+
+        int v1 = 1, v4 = 4;
+        list.pushFront(v1);
+        list.pushBack(v4);
+
+        for (int i = 0; i < 4; ++i) {
+            EXPECT_EQ(list[i].value, i + 1);
+        }
+
+        EXPECT_EQ(list.popFront(), 1);
+        EXPECT_EQ(list.popFront(), 2);
+    }
+
+    EXPECT_EQ(countingRes.allocations, countingRes.deallocations);
+}
+
+TEST_F(NodeAllocationPolicyTest, SinglePushesShareSlabs) {
+    SlabList list(countingAlloc);
+
+    for (int i = 0; i < 8; ++i) {
+        list.pushBack(i);
+    }
+
+    // Первый открытый блок вмещает 8 узлов
+    EXPECT_EQ(countingRes.allocations, 1);
+}
+
+TEST_F(NodeAllocationPolicyTest, QueueChurnReleasesSlabs) {
+    {
+        SlabList list(countingAlloc);
+
+        for (int i = 0; i < 1000; ++i) {
+            list.pushBack(i);
+            EXPECT_EQ(list.popFront(), i);
+        }
+
+        EXPECT_TRUE(list.isEmpty());
+        EXPECT_LE(countingRes.allocations - countingRes.deallocations, 1);
+    }
+
+    EXPECT_EQ(countingRes.allocations, countingRes.deallocations);
+}
+
+// ============ Перенос узлов между списками ============
+TEST_F(NodeAllocationPolicyTest, SpliceBetweenSlabListsTracksOwnership) {
+    {
+        SlabList list({1, 5}, countingAlloc);
+
+        {
+            SlabList other({2, 3, 4}, countingAlloc);
+            list.spliceAfter(list.begin(), other);
+        }
+
+        EXPECT_EQ(list.getSize(), 5);
+        for (int i = 0; i < 5; ++i) {
+            EXPECT_EQ(list[i].value, i + 1);
+        }
+
+        while (!list.isEmpty()) {
+            list.popFront();
+        }
+    }
+
+    EXPECT_EQ(countingRes.allocations, countingRes.deallocations);
+}
+
+TEST_F(NodeAllocationPolicyTest, SpliceRangeSharesSlab) {
+    {
+        SlabList list(countingAlloc);
+        SlabList other({1, 2, 3, 4}, countingAlloc);
+
+        auto last = other.begin();
+        ++last;
+        ++last;
+        list.spliceAfter(list.beforeBegin(), other, other.beforeBegin(), last);
+
+        EXPECT_EQ(list.getSize(), 2);
+        EXPECT_EQ(other.getSize(), 2);
+
+        // Блок используется обоими списками и не освобождается раньше времени
+        list.popFront();
+        list.popFront();
+        EXPECT_EQ(countingRes.deallocations, 0);
+        EXPECT_EQ(other[0].value, 3);
+    }
+
+    EXPECT_EQ(countingRes.allocations, countingRes.deallocations);
+}
+
+TEST_F(NodeAllocationPolicyTest, MoveConstructorTransfersSlabs) {
+    {
+        SlabList list({1, 2, 3}, countingAlloc);
+        SlabList moved(std::move(list));
+
+        EXPECT_EQ(list.getSize(), 0);
+        EXPECT_EQ(moved.getSize(), 3);
+        EXPECT_EQ(moved.popFront(), 1);
+    }
+
+    EXPECT_EQ(countingRes.allocations, countingRes.deallocations);
+}
+
+TEST_F(NodeAllocationPolicyTest, SlabWithMemoryResource) {
+    MemoryResource mres;
+    std::pmr::polymorphic_allocator<ListItem<int>> polyAlloc{&mres};
+
+    SlabList list({1, 2, 3, 4, 5}, polyAlloc);
+    for (int i = 6; i <= 20; ++i) {
+        list.pushBack(i);
+    }
+
+    for (int i = 1; i <= 20; ++i) {
+        EXPECT_EQ(list.popFront(), i);
+    }
+}
+
+// Список, который раз за разом пустеет и заполняется, не наращивает блоки:
+// буфера MemoryResource хватает на маленький блок, но не на растущие
+TEST_F(NodeAllocationPolicyTest, SlabSizeResetsWhenListDrains) {
+    struct Big {
+        char payload[64];
+        int value;
+    };
+
+    MemoryResource mres;
+    LinkedList<Big, std::pmr::polymorphic_allocator<ListItem<Big>>, SlabAllocation> list{
+        std::pmr::polymorphic_allocator<ListItem<Big>>(&mres)
+    };
+
+    for (int i = 0; i < 100; ++i) {
+        list.pushBack(Big{{}, i});
+        ASSERT_EQ(list.popFront().value, i);
+    }
+
+    EXPECT_TRUE(list.isEmpty());
+}
+
+TEST_F(NodeAllocationPolicyTest, CloneSingleAllocation) {
+    SlabList list(countingAlloc);
+    for (int i = 0; i < 50; ++i) {
+        list.pushFront(i);
+    }
+
+    CountingResource targetRes;
+    SlabList copy = list.clone(&targetRes);
+
+    EXPECT_EQ(targetRes.allocations, 1);
+    for (size_t i = 1; i < copy.getSize(); ++i) {
+        EXPECT_EQ(&copy[i], &copy[i - 1] + 1);
+    }
+    EXPECT_EQ(copy.popBack(), 0);
+}
+
+// ============ Тесты clear ============
+TEST_F(NodeAllocationPolicyTest, ClearReleasesSlabsWholesale) {
+    SlabList list(countingAlloc);
+    for (int i = 0; i < 100; ++i) {
+        list.pushBack(i);
+    }
+
+    list.clear();
+
+    EXPECT_EQ(list.getSize(), 0);
+    EXPECT_EQ(countingRes.allocations, countingRes.deallocations);
+
+    int value = 7;
+    list.pushBack(value);
+    EXPECT_EQ(list.popFront(), 7);
+}
+
+TEST_F(NodeAllocationPolicyTest, ClearWithSharedSlabKeepsOtherList) {
+    SlabList list({1, 2, 3, 4}, countingAlloc);
+    SlabList other(countingAlloc);
+
+    auto last = list.begin();
+    ++last;
+    ++last;
+    other.spliceAfter(other.beforeBegin(), list, list.beforeBegin(), last);
+
+    list.clear();
+
+    EXPECT_EQ(other.getSize(), 2);
+    EXPECT_EQ(other.popFront(), 1);
+    EXPECT_EQ(other.popFront(), 2);
+    EXPECT_EQ(countingRes.allocations, countingRes.deallocations);
+}
+
+TEST_F(NodeAllocationPolicyTest, ClearPerNodeList) {
+    PerNodeList list({1, 2, 3}, countingAlloc);
+
+    list.clear();
+
+    EXPECT_TRUE(list.isEmpty());
+    EXPECT_EQ(countingRes.deallocations, 3);
+}
+
+// ============ Встроенные узлы ============
+TEST_F(NodeAllocationPolicyTest, InlineSmallListSkipsAllocator) {
+    {
+        InlineList list({1, 2, 3}, countingAlloc);
+        int value = 4;
+        list.pushFront(value);
+
+        EXPECT_EQ(toVector(list), (std::vector<int>{4, 1, 2, 3}));
+    }
+
+    EXPECT_EQ(countingRes.allocations, 0);
+    EXPECT_EQ(countingRes.deallocations, 0);
+}
+
+TEST_F(NodeAllocationPolicyTest, InlineSpillsPastCapacity) {
+    {
+        InlineList list({1, 2, 3, 4, 5, 6}, countingAlloc);
+
+        EXPECT_EQ(toVector(list), (std::vector<int>{1, 2, 3, 4, 5, 6}));
+        EXPECT_EQ(countingRes.allocations, 2);
+    }
+
+    EXPECT_EQ(countingRes.deallocations, 2);
+}
+
+TEST_F(NodeAllocationPolicyTest, InlineReusesFreedSlots) {
+    InlineList list({1, 2, 3, 4}, countingAlloc);
+
+    list.popFront();
+    list.popBack();
+    int value = 5;
+    list.pushBack(value);
+    list.pushBack(value);
+
+    EXPECT_EQ(toVector(list), (std::vector<int>{2, 3, 5, 5}));
+    EXPECT_EQ(countingRes.allocations, 0);
+}
+
+TEST_F(NodeAllocationPolicyTest, InlineMoveRelocatesNodes) {
+    auto source = std::make_unique<InlineList>(std::initializer_list<int>{1, 2, 3, 4, 5, 6}, countingAlloc);
+    InlineList moved(std::move(*source));
+    source.reset();
+
+    EXPECT_EQ(moved.getSize(), 6);
+    EXPECT_EQ(toVector(moved), (std::vector<int>{1, 2, 3, 4, 5, 6}));
+    EXPECT_EQ(countingRes.allocations, 2);
+
+    // Список после перемещения полностью рабочий, освобождённая ячейка буфера используется снова
+    EXPECT_EQ(moved.popFront(), 1);
+    int value = 7;
+    moved.pushBack(value);
+    EXPECT_EQ(moved.popBack(), 7);
+    EXPECT_EQ(countingRes.allocations, 2);
+}
+
+TEST_F(NodeAllocationPolicyTest, InlineMoveOfStrings) {
+    using StringList = LinkedList<std::string, std::pmr::polymorphic_allocator<ListItem<std::string>>, InlineAllocation<2>>;
+    std::pmr::polymorphic_allocator<ListItem<std::string>> alloc(&countingRes);
+
+    auto source = std::make_unique<StringList>(
+        std::initializer_list<std::string>{"first value beyond small string", "second", "third"}, alloc
+    );
+    StringList moved(std::move(*source));
+    source.reset();
+
+    ASSERT_EQ(moved.getSize(), 3);
+    EXPECT_EQ(moved.popFront(), "first value beyond small string");
+    EXPECT_EQ(moved.popFront(), "second");
+    EXPECT_EQ(moved.popFront(), "third");
+}
+
+TEST_F(NodeAllocationPolicyTest, InlineSpliceOutlivesSource) {
+    InlineList target({10}, countingAlloc);
+    {
+        InlineList source({1, 2, 3}, countingAlloc);
+        target.spliceAfter(target.begin(), source);
+
+        EXPECT_TRUE(source.isEmpty());
+    }
+
+    EXPECT_EQ(toVector(target), (std::vector<int>{10, 1, 2, 3}));
+    EXPECT_EQ(countingRes.allocations, 0);
+}
+
+TEST_F(NodeAllocationPolicyTest, InlineSpliceRangeOutlivesSource) {
+    InlineList target(countingAlloc);
+    {
+        InlineList source({1, 2, 3, 4, 5, 6}, countingAlloc);
+        auto last = source.begin();
+        for (int i = 0; i < 4; ++i) {
+            ++last;
+        }
+
+        target.spliceAfter(target.beforeBegin(), source, source.begin(), last);
+
+        EXPECT_EQ(toVector(source), (std::vector<int>{1, 5, 6}));
+    }
+
+    EXPECT_EQ(toVector(target), (std::vector<int>{2, 3, 4}));
+}
+
+TEST_F(NodeAllocationPolicyTest, InlineWithSlabFallback) {
+    {
+        InlineSlabList list(10, countingAlloc);
+
+        EXPECT_EQ(list.getSize(), 10);
+        EXPECT_EQ(countingRes.allocations, 1);
+
+        list.clear();
+        EXPECT_EQ(countingRes.deallocations, 1);
+
+        InlineSlabList copy = list.clone();
+        EXPECT_TRUE(copy.isEmpty());
+    }
+
+    EXPECT_EQ(countingRes.allocations, countingRes.deallocations);
+}
+
+// ============ Размещение значений в ресурсе списка ============
+TEST_F(NodeAllocationPolicyTest, PmrStringPayloadSharesListResource) {
+    using StringList = LinkedList<std::pmr::string, std::pmr::polymorphic_allocator<ListItem<std::pmr::string>>>;
+    StringList list{std::pmr::polymorphic_allocator<ListItem<std::pmr::string>>(&countingRes)};
+
+    std::pmr::string value("payload long enough to leave the small string buffer", std::pmr::new_delete_resource());
+    list.pushBack(value);
+
+    EXPECT_EQ(list[0].value, value);
+    EXPECT_EQ(list[0].value.get_allocator().resource(), &countingRes);
+    EXPECT_EQ(countingRes.allocations, 2);
+}
+
+TEST_F(NodeAllocationPolicyTest, EmplaceConstructsPayloadInListResource) {
+    using StringList = LinkedList<std::pmr::string, std::pmr::polymorphic_allocator<ListItem<std::pmr::string>>>;
+    StringList list{std::pmr::polymorphic_allocator<ListItem<std::pmr::string>>(&countingRes)};
+
+    std::pmr::string& back = list.emplaceBack(40, 'x');
+    std::pmr::string& front = list.emplaceFront("front");
+
+    EXPECT_EQ(back, std::pmr::string(40, 'x'));
+    EXPECT_EQ(front, "front");
+    EXPECT_EQ(back.get_allocator().resource(), &countingRes);
+    EXPECT_EQ(front.get_allocator().resource(), &countingRes);
+}
+
+TEST_F(NodeAllocationPolicyTest, BatchNodesGetListResource) {
+    using VectorList = LinkedList<std::pmr::vector<int>, std::pmr::polymorphic_allocator<ListItem<std::pmr::vector<int>>>, SlabAllocation>;
+    VectorList list(3, std::pmr::polymorphic_allocator<ListItem<std::pmr::vector<int>>>(&countingRes));
+
+    for (auto it = list.begin(); it != list.end(); ++it) {
+        EXPECT_EQ((*it).get_allocator().resource(), &countingRes);
+    }
+
+    std::pmr::unsynchronized_pool_resource otherPool;
+    VectorList copy = list.clone(std::pmr::polymorphic_allocator<ListItem<std::pmr::vector<int>>>(&otherPool));
+    for (auto it = copy.begin(); it != copy.end(); ++it) {
+        EXPECT_EQ((*it).get_allocator().resource(), &otherPool);
+    }
+}
+
+TEST_F(NodeAllocationPolicyTest, MovedPayloadIsCopiedIntoListResource) {
+    using StringList = LinkedList<std::pmr::string, std::pmr::polymorphic_allocator<ListItem<std::pmr::string>>>;
+    StringList list{std::pmr::polymorphic_allocator<ListItem<std::pmr::string>>(&countingRes)};
+
+    std::pmr::string value("moved payload long enough to leave the small string buffer", std::pmr::new_delete_resource());
+    list.pushFront(std::move(value));
+
+    EXPECT_EQ(list[0].value, "moved payload long enough to leave the small string buffer");
+    EXPECT_EQ(list[0].value.get_allocator().resource(), &countingRes);
+}
+
+// ============ Пакетное освобождение ============
+TEST_F(NodeAllocationPolicyTest, RemoveIfReleasesInBatches) {
+    BatchCountingResource batchRes;
+    PerNodeList list{std::pmr::polymorphic_allocator<ListItem<int>>(&batchRes)};
+    for (int i = 0; i < 200; ++i) {
+        list.pushBack(i);
+    }
+
+    size_t removed = list.removeIf([](int value) { return value % 2 == 0; });
+
+    EXPECT_EQ(removed, 100);
+    EXPECT_EQ(list.getSize(), 100);
+    EXPECT_EQ(batchRes.batches, (100 + PerNodeList::REMOVE_BATCH_SIZE - 1) / PerNodeList::REMOVE_BATCH_SIZE);
+    EXPECT_EQ(batchRes.deallocations, 0);
+}
+
+// Ресурс без пакетного освобождения получает узлы по одному
+TEST_F(NodeAllocationPolicyTest, RemoveIfWithPlainResource) {
+    PerNodeList list({1, 2, 3, 4, 5}, countingAlloc);
+
+    list.removeIf([](int value) { return value > 2; });
+
+    EXPECT_EQ(countingRes.deallocations, 3);
+    EXPECT_EQ(toVector(list), (std::vector<int>{1, 2}));
+}
+
+TEST_F(NodeAllocationPolicyTest, RemoveIfReleasesEmptySlabs) {
+    {
+        SlabList list(countingAlloc);
+        list.append(std::vector<int>(100, 1));
+        list.append(std::vector<int>(100, 2));
+
+        list.erase(1);
+
+        EXPECT_EQ(list.getSize(), 100);
+        EXPECT_EQ(countingRes.deallocations, 1);
+    }
+
+    EXPECT_EQ(countingRes.deallocations, 2);
+}
+
+TEST_F(NodeAllocationPolicyTest, RemoveIfReturnsInlineSlots) {
+    BatchCountingResource batchRes;
+    InlineList list{std::pmr::polymorphic_allocator<ListItem<int>>(&batchRes)};
+    for (int i = 0; i < 8; ++i) {
+        list.pushBack(i);
+    }
+
+    list.removeIf([](int value) { return value % 2 == 1; });
+
+    EXPECT_EQ(toVector(list), (std::vector<int>{0, 2, 4, 6}));
+    EXPECT_EQ(batchRes.batches, 1);
+
+    for (int i = 10; i < 12; ++i) {
+        list.pushBack(i);
+    }
+    EXPECT_EQ(toVector(list), (std::vector<int>{0, 2, 4, 6, 10, 11}));
+}
+
+// ============ Кэш освобождённых узлов ============
+TEST_F(NodeAllocationPolicyTest, RecyclingQueueChurnSkipsAllocator) {
+    RecyclingPerNodeList list(countingAlloc);
+    for (int i = 0; i < 4; ++i) {
+        list.pushBack(i);
+    }
+    list.popFront();
+    size_t allocationsBefore = countingRes.allocations;
+
+    for (int i = 4; i < 10000; ++i) {
+        list.pushBack(i);
+        list.popFront();
+    }
+
+    EXPECT_EQ(countingRes.allocations, allocationsBefore);
+    EXPECT_EQ(countingRes.deallocations, 0);
+    EXPECT_EQ(toVector(list), (std::vector<int>{9997, 9998, 9999}));
+}
+
+TEST_F(NodeAllocationPolicyTest, RecyclingCacheIsCapped) {
+    RecyclingPerNodeList list(countingAlloc);
+    for (int i = 0; i < 10; ++i) {
+        list.pushBack(i);
+    }
+
+    while (!list.isEmpty()) {
+        list.popFront();
+    }
+
+    EXPECT_EQ(countingRes.deallocations, 6);
+    EXPECT_EQ(list.getCapacity(), 4);
+}
+
+TEST_F(NodeAllocationPolicyTest, ReserveSingleAllocation) {
+    RecyclingList list(countingAlloc);
+    list.reserve(100);
+
+    EXPECT_EQ(countingRes.allocations, 1);
+    EXPECT_EQ(list.getCapacity(), 100);
+
+    for (int i = 0; i < 100; ++i) {
+        list.pushBack(i);
+    }
+    for (int i = 0; i < 100; ++i) {
+        list.popFront();
+    }
+    for (int i = 0; i < 100; ++i) {
+        list.pushFront(i);
+    }
+
+    // Предел кэша поднят до зарезервированного размера
+    EXPECT_EQ(countingRes.allocations, 1);
+    EXPECT_EQ(countingRes.deallocations, 0);
+}
+
+TEST_F(NodeAllocationPolicyTest, ReserveCountsExistingElements) {
+    RecyclingList list({1, 2, 3}, countingAlloc);
+    size_t allocationsBefore = countingRes.allocations;
+
+    list.reserve(2);
+    EXPECT_EQ(countingRes.allocations, allocationsBefore);
+
+    list.reserve(10);
+    EXPECT_EQ(countingRes.allocations, allocationsBefore + 1);
+    EXPECT_EQ(list.getCapacity(), 10);
+}
+
+TEST_F(NodeAllocationPolicyTest, RecyclingBatchUsesCache) {
+    RecyclingList list(countingAlloc);
+    list.reserve(8);
+
+    list.append(std::vector<int>{1, 2, 3, 4, 5});
+
+    EXPECT_EQ(countingRes.allocations, 1);
+    EXPECT_EQ(toVector(list), (std::vector<int>{1, 2, 3, 4, 5}));
+}
+
+// clear() оставляет узлы в кэше, shrinkToFit() возвращает их аллокатору
+TEST_F(NodeAllocationPolicyTest, RecyclingClearKeepsCache) {
+    {
+        RecyclingPerNodeList list(countingAlloc);
+        for (int i = 0; i < 3; ++i) {
+            list.pushBack(i);
+        }
+        list.popFront();
+
+        list.clear();
+
+        EXPECT_EQ(countingRes.deallocations, 0);
+        EXPECT_EQ(list.getCapacity(), 3);
+
+        list.shrinkToFit();
+
+        EXPECT_EQ(countingRes.deallocations, 3);
+        EXPECT_EQ(list.getCapacity(), 0);
+    }
+
+    EXPECT_EQ(countingRes.allocations, countingRes.deallocations);
+}
+
+TEST_F(NodeAllocationPolicyTest, ReserveSurvivesClear) {
+    {
+        RecyclingList list(countingAlloc);
+        list.reserve(100);
+
+        for (int round = 0; round < 3; ++round) {
+            for (int i = 0; i < 100; ++i) {
+                list.pushBack(i);
+            }
+            list.clear();
+        }
+
+        EXPECT_EQ(countingRes.allocations, 1);
+        EXPECT_EQ(countingRes.deallocations, 0);
+        EXPECT_EQ(list.getCapacity(), 100);
+    }
+
+    EXPECT_EQ(countingRes.allocations, countingRes.deallocations);
+}
+
+// Узел из кэша одного списка после переноса освобождается другим
+TEST_F(NodeAllocationPolicyTest, RecyclingSpliceBetweenLists) {
+    {
+        RecyclingList source(countingAlloc);
+        source.reserve(10);
+        for (int i = 0; i < 5; ++i) {
+            source.pushBack(i);
+        }
+
+        RecyclingList target(countingAlloc);
+        target.spliceAfter(target.beforeBegin(), source);
+
+        source.reserve(10);
+        target.popFront();
+
+        EXPECT_EQ(toVector(target), (std::vector<int>{1, 2, 3, 4}));
+        EXPECT_EQ(target.getCapacity(), 5);
+    }
+
+    EXPECT_EQ(countingRes.allocations, countingRes.deallocations);
+}
+
+TEST_F(NodeAllocationPolicyTest, RecyclingMoveKeepsCache) {
+    RecyclingList list(countingAlloc);
+    list.reserve(20);
+    list.pushBack(1);
+
+    RecyclingList moved(std::move(list));
+
+    EXPECT_EQ(moved.getCapacity(), 20);
+    EXPECT_EQ(list.getCapacity(), 0);
+}
+
+// ============ Перемещающее присваивание и обмен ============
+TEST_F(NodeAllocationPolicyTest, MoveAssignSameResourceAllocatesNothing) {
+    SlabList list({1, 2, 3}, countingAlloc);
+    SlabList other({4, 5, 6, 7}, countingAlloc);
+    size_t allocationsBefore = countingRes.allocations;
+
+    list = std::move(other);
+
+    EXPECT_EQ(countingRes.allocations, allocationsBefore);
+    EXPECT_EQ(countingRes.deallocations, 1);
+    EXPECT_EQ(toVector(list), (std::vector<int>{4, 5, 6, 7}));
+}
+
+TEST_F(NodeAllocationPolicyTest, MoveAssignAcrossResourcesUsesDestination) {
+    std::pmr::unsynchronized_pool_resource otherPool;
+    using StringList = LinkedList<std::pmr::string, std::pmr::polymorphic_allocator<ListItem<std::pmr::string>>, SlabAllocation>;
+    StringList list{std::pmr::polymorphic_allocator<ListItem<std::pmr::string>>(&countingRes)};
+    StringList other{std::pmr::polymorphic_allocator<ListItem<std::pmr::string>>(&otherPool)};
+    other.emplaceBack("first value long enough to leave the small string buffer");
+    other.emplaceBack("second value long enough to leave the small string buffer");
+
+    list = std::move(other);
+
+    EXPECT_TRUE(other.isEmpty());
+    ASSERT_EQ(list.getSize(), 2);
+    for (auto it = list.begin(); it != list.end(); ++it) {
+        EXPECT_EQ((*it).get_allocator().resource(), &countingRes);
+    }
+
+    // Один пакет узлов и две строки
+    EXPECT_EQ(countingRes.allocations, 3);
+}
+
+TEST_F(NodeAllocationPolicyTest, SwapSameResourceAllocatesNothing) {
+    SlabList left({1, 2, 3}, countingAlloc);
+    SlabList right({4, 5}, countingAlloc);
+    size_t allocationsBefore = countingRes.allocations;
+
+    left.swap(right);
+
+    EXPECT_EQ(countingRes.allocations, allocationsBefore);
+    EXPECT_EQ(countingRes.deallocations, 0);
+    EXPECT_EQ(toVector(left), (std::vector<int>{4, 5}));
+    EXPECT_EQ(toVector(right), (std::vector<int>{1, 2, 3}));
+}
+
+TEST_F(NodeAllocationPolicyTest, SwapInlineLists) {
+    InlineList left(countingAlloc);
+    InlineList right(countingAlloc);
+    for (int i = 0; i < 6; ++i) {
+        left.pushBack(i);
+    }
+    right.pushBack(10);
+
+    left.swap(right);
+
+    EXPECT_EQ(toVector(left), (std::vector<int>{10}));
+    EXPECT_EQ(toVector(right), (std::vector<int>{0, 1, 2, 3, 4, 5}));
+}
+
+// Нехватка памяти при переносе между ресурсами не трогает значения источника
+TEST_F(NodeAllocationPolicyTest, FailedMoveAssignAcrossResourcesKeepsBoth) {
+    using StringList = LinkedList<std::string, std::pmr::polymorphic_allocator<ListItem<std::string>>, PerNodeAllocation>;
+    std::vector<std::string> values = {std::string(40, 'a'), std::string(40, 'b'), std::string(40, 'c'), std::string(40, 'd')};
+
+    CountingResource otherRes;
+    StringList list({"kept"}, &countingRes);
+    StringList other(&otherRes);
+    for (const std::string& value : values) {
+        other.emplaceBack(value);
+    }
+
+    countingRes.failAfter(2);
+    EXPECT_THROW(list = std::move(other), std::bad_alloc);
+    countingRes.stopFailing();
+
+    EXPECT_EQ(toStrings(list), (std::vector<std::string>{"kept"}));
+    EXPECT_EQ(toStrings(other), values);
+}
+
+TEST_F(NodeAllocationPolicyTest, FailedSwapAcrossResourcesKeepsBoth) {
+    using StringList = LinkedList<std::string, std::pmr::polymorphic_allocator<ListItem<std::string>>, PerNodeAllocation>;
+    std::vector<std::string> leftValues = {std::string(40, 'a'), std::string(40, 'b')};
+    std::vector<std::string> rightValues = {std::string(40, 'c'), std::string(40, 'd'), std::string(40, 'e')};
+
+    CountingResource otherRes;
+    StringList left(&countingRes);
+    StringList right(&otherRes);
+    for (const std::string& value : leftValues) {
+        left.emplaceBack(value);
+    }
+    for (const std::string& value : rightValues) {
+        right.emplaceBack(value);
+    }
+
+    // Копия для left строится, копия для right - нет
+    otherRes.failAfter(1);
+    EXPECT_THROW(left.swap(right), std::bad_alloc);
+    otherRes.stopFailing();
+
+    EXPECT_EQ(toStrings(left), leftValues);
+    EXPECT_EQ(toStrings(right), rightValues);
+
+    left.swap(right);
+    EXPECT_EQ(toStrings(left), rightValues);
+    EXPECT_EQ(toStrings(right), leftValues);
+}
+
+TEST_F(NodeAllocationPolicyTest, MoveAssignKeepsRecyclingCache) {
+    RecyclingList list(countingAlloc);
+    RecyclingList other(countingAlloc);
+    other.reserve(32);
+
+    list = std::move(other);
+
+    EXPECT_EQ(list.getCapacity(), 32);
+    EXPECT_EQ(other.getCapacity(), 0);
+}
@@ -0,0 +1,215 @@
+#include <gtest/gtest.h>
+#include "../include/LinkedList.hpp"
+#include "../include/ParallelAlgorithms.hpp"
+
+#include <atomic>
+#include <cmath>
+#include <future>
+#include <memory_resource>
+#include <stdexcept>
+
+// Тесты параллельных алгоритмов над LinkedList
+class ParallelAlgorithmsTest : public ::testing::Test {
+protected:
+    std::pmr::unsynchronized_pool_resource pool;
+    std::pmr::polymorphic_allocator<ListItem<int>> polyAlloc{&pool};
+    ThreadPool threads{4};
+
+    using ListType = LinkedList<int, std::pmr::polymorphic_allocator<ListItem<int>>>;
+
+    ListType makeSequence(int count) {
+        ListType list(polyAlloc);
+        for (int i = 1; i <= count; ++i) {
+            list.pushBack(i);
+        }
+        return list;
+    }
+};
+
+// ============ Тесты разбиения на сегменты ============
+TEST_F(ParallelAlgorithmsTest, SegmentsCoverWholeList) {
+    ListType list = makeSequence(103);
+
+    auto segments = makeSegments(list, 10);
+
+    EXPECT_EQ(segments.size(), 10);
+
+    size_t total = 0;
+    int expectedFirst = 1;
+    for (auto& segment : segments) {
+        EXPECT_EQ(*segment.first, expectedFirst);
+        expectedFirst += segment.length;
+        total += segment.length;
+    }
+    EXPECT_EQ(total, 103);
+}
+
+TEST_F(ParallelAlgorithmsTest, SegmentsForShortList) {
+    ListType list = makeSequence(3);
+
+    auto segments = makeSegments(list, 16);
+
+    EXPECT_EQ(segments.size(), 3);
+}
+
+TEST_F(ParallelAlgorithmsTest, SegmentsForEmptyList) {
+    ListType list(polyAlloc);
+
+    EXPECT_TRUE(makeSegments(list, 4).empty());
+    EXPECT_EQ(parallelReduce(list, 0, std::plus<int>(), threads), 0);
+}
+
+// ============ Тесты алгоритмов ============
+TEST_F(ParallelAlgorithmsTest, ForEachVisitsEveryElement) {
+    ListType list = makeSequence(1000);
+    std::atomic<long long> sum(0);
+
+    parallelForEach(list, [&sum](int value) {
+        sum += value;
+    }, threads);
+
+    EXPECT_EQ(sum.load(), 500500);
+}
+
+TEST_F(ParallelAlgorithmsTest, TransformInPlace) {
+    ListType list = makeSequence(500);
+
+    parallelTransform(list, [](int value) {
+        return value * 2;
+    }, threads);
+
+    int expected = 2;
+    for (auto it = list.begin(); it != list.end(); ++it, expected += 2) {
+        EXPECT_EQ(*it, expected);
+    }
+}
+
+TEST_F(ParallelAlgorithmsTest, ReduceSum) {
+    ListType list = makeSequence(10000);
+
+    long long sum = parallelReduce(list, 0LL, std::plus<long long>(), [](int value) {
+        return static_cast<long long>(value);
+    }, threads);
+
+    EXPECT_EQ(sum, 50005000LL);
+}
+
+TEST_F(ParallelAlgorithmsTest, ReduceKeepsSegmentOrder) {
+    ListType list = makeSequence(9);
+
+    // Некоммутативная, но ассоциативная операция: конкатенация строк
+    std::string joined = parallelReduce(list, std::string(), std::plus<std::string>(), [](int value) {
+        return std::to_string(value);
+    }, threads);
+
+    EXPECT_EQ(joined, "123456789");
+}
+
+TEST_F(ParallelAlgorithmsTest, ReuseCachedSegments) {
+    ListType list = makeSequence(100);
+    auto segments = makeSegments(list, 8);
+
+    parallelTransform(segments, [](int value) {
+        return value + 1;
+    }, threads);
+    int sum = parallelReduce(segments, 0, std::plus<int>(), [](int value) {
+        return value;
+    }, threads);
+
+    EXPECT_EQ(sum, 5050 + 100);
+}
+
+TEST_F(ParallelAlgorithmsTest, ReduceStructField) {
+    struct Student {
+        std::string name;
+        int age;
+        double gpa;
+    };
+
+    std::pmr::polymorphic_allocator<ListItem<Student>> studentAlloc{&pool};
+    LinkedList<Student, std::pmr::polymorphic_allocator<ListItem<Student>>> students(studentAlloc);
+
+    for (int i = 0; i < 200; ++i) {
+        Student student{"student" + std::to_string(i), 20, 2.5};
+        students.pushBack(student);
+    }
+
+    double gpaSum = parallelReduce(students, 0.0, std::plus<double>(), [](const Student& student) {
+        return student.gpa;
+    }, threads);
+
+    EXPECT_DOUBLE_EQ(gpaSum, 500.0);
+}
+
+TEST_F(ParallelAlgorithmsTest, ExceptionPropagates) {
+    ListType list = makeSequence(100);
+
+    EXPECT_THROW(parallelForEach(list, [](int value) {
+        if (value == 50) {
+            throw std::runtime_error("failure");
+        }
+    }, threads), std::runtime_error);
+}
+
+// ============ Тесты пула потоков ============
+TEST(ThreadPoolTest, SubmitRunsTasks) {
+    ThreadPool pool(2);
+    std::atomic<int> counter(0);
+
+    std::vector<std::function<void()>> tasks;
+    for (int i = 0; i < 100; ++i) {
+        tasks.push_back([&counter]() {
+            ++counter;
+        });
+    }
+
+    pool.runAndWait(tasks);
+
+    EXPECT_EQ(counter.load(), 100);
+    EXPECT_EQ(pool.getThreadCount(), 2);
+}
+
+// Исключение задачи приходит в future, пул продолжает работать
+TEST(ThreadPoolTest, SubmitPassesExceptionToFuture) {
+    ThreadPool pool(2);
+
+    std::future<void> failed = pool.submit([]() {
+        throw std::runtime_error("failure");
+    });
+    EXPECT_THROW(failed.get(), std::runtime_error);
+
+    std::atomic<int> counter(0);
+    std::vector<std::future<void>> done;
+    for (int i = 0; i < 10; ++i) {
+        done.push_back(pool.submit([&counter]() {
+            ++counter;
+        }));
+    }
+    for (auto& future : done) {
+        future.get();
+    }
+
+    EXPECT_EQ(counter.load(), 10);
+}
+
+// Задача из submit, выполненная вызывающим потоком runAndWait, не прерывает пакет
+TEST(ThreadPoolTest, ThrowingSubmittedTaskDoesNotBreakRunAndWait) {
+    ThreadPool pool(1);
+    std::vector<std::future<void>> failed;
+    for (int i = 0; i < 20; ++i) {
+        failed.push_back(pool.submit([]() {
+            throw std::runtime_error("failure");
+        }));
+    }
+
+    std::atomic<int> counter(0);
+    std::vector<std::function<void()>> tasks(50, [&counter]() {
+        ++counter;
+    });
+    pool.runAndWait(tasks);
+
+    EXPECT_EQ(counter.load(), 50);
+    for (auto& future : failed) {
+        EXPECT_THROW(future.get(), std::runtime_error);
+    }
+}
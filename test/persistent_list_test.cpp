@@ -0,0 +1,138 @@
+#include <gtest/gtest.h>
+#include "../include/PersistentList.hpp"
+#include "counting_resource.hpp"
+
+#include <atomic>
+#include <memory_resource>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Тесты неизменяемого списка со структурным разделением
+class PersistentListTest : public ::testing::Test {
+protected:
+    CountingResource countingRes;
+
+    using ListType = PersistentList<int>;
+
+    template <typename ListType>
+    static std::vector<typename ListType::elementType> collect(const ListType& list) {
+        return std::vector<typename ListType::elementType>(list.begin(), list.end());
+    }
+};
+
+TEST_F(PersistentListTest, InitializerListKeepsOrder) {
+    ListType list({1, 2, 3}, &countingRes);
+
+    EXPECT_EQ(list.getSize(), 3);
+    EXPECT_EQ(list.front(), 1);
+    EXPECT_EQ(collect(list), (std::vector<int>{1, 2, 3}));
+}
+
+TEST_F(PersistentListTest, PushFrontKeepsOldVersion) {
+    ListType base({2, 3}, &countingRes);
+    ListType extended = base.pushFront(1);
+
+    EXPECT_EQ(collect(base), (std::vector<int>{2, 3}));
+    EXPECT_EQ(collect(extended), (std::vector<int>{1, 2, 3}));
+    EXPECT_EQ(countingRes.liveBlocks(), 3);
+}
+
+TEST_F(PersistentListTest, VersionsShareTail) {
+    ListType base({2, 3}, &countingRes);
+    ListType extended = base.pushFront(1);
+
+    EXPECT_EQ(&*base.begin(), &*(++extended.begin()));
+    EXPECT_EQ(&extended.popFront().front(), &base.front());
+}
+
+TEST_F(PersistentListTest, SnapshotDoesNotAllocate) {
+    ListType list({1, 2, 3}, &countingRes);
+    long blocksBefore = countingRes.liveBlocks();
+
+    ListType snapshot = list;
+    list = list.popFront();
+
+    EXPECT_EQ(countingRes.liveBlocks(), blocksBefore);
+    EXPECT_EQ(collect(snapshot), (std::vector<int>{1, 2, 3}));
+    EXPECT_EQ(collect(list), (std::vector<int>{2, 3}));
+}
+
+TEST_F(PersistentListTest, LastVersionReleasesNodes) {
+    {
+        ListType base({1, 2}, &countingRes);
+        ListType left = base.pushFront(10);
+        ListType right = base.pushFront(20);
+        base = ListType(&countingRes);
+
+        EXPECT_EQ(countingRes.liveBlocks(), 4);
+        left = left.popFront().popFront();
+        EXPECT_EQ(countingRes.liveBlocks(), 3);  // узел 1 ещё нужен right
+    }
+
+    EXPECT_EQ(countingRes.liveBlocks(), 0);
+}
+
+TEST_F(PersistentListTest, LongChainReleasedWithoutRecursion) {
+    {
+        ListType list(&countingRes);
+        for (int i = 0; i < 1000000; ++i) {
+            list = list.pushFront(i);
+        }
+        EXPECT_EQ(list.getSize(), 1000000);
+    }
+
+    EXPECT_EQ(countingRes.liveBlocks(), 0);
+}
+
+TEST_F(PersistentListTest, PopFromEmptyThrows) {
+    ListType list(&countingRes);
+
+    EXPECT_THROW(list.popFront(), std::out_of_range);
+    EXPECT_THROW(list.front(), std::out_of_range);
+}
+
+TEST_F(PersistentListTest, NonTrivialElements) {
+    PersistentList<std::string> list({"b"}, &countingRes);
+    PersistentList<std::string> extended = list.emplaceFront(3, 'a');
+
+    EXPECT_EQ(extended.front(), "aaa");
+    EXPECT_EQ(extended.popFront().front(), "b");
+}
+
+// ============ Тесты снимков между потоками ============
+TEST_F(PersistentListTest, ReadersSeeConsistentSnapshots) {
+    std::pmr::synchronized_pool_resource sharedRes;
+    PersistentList<int> current(&sharedRes);
+    std::atomic<bool> failed(false);
+    std::vector<std::thread> readers;
+
+    for (int step = 0; step < 200; ++step) {
+        current = current.pushFront(step);
+
+        PersistentList<int> snapshot = current;
+        readers.emplace_back([snapshot, &failed]() {
+            // Версия с вершиной k содержит k, k-1, ..., 0
+            int expected = snapshot.front();
+            for (int value : snapshot) {
+                if (value != expected--) {
+                    failed = true;
+                }
+            }
+        });
+
+        if (readers.size() == 8) {
+            for (auto& reader : readers) {
+                reader.join();
+            }
+            readers.clear();
+        }
+    }
+
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    EXPECT_FALSE(failed);
+    EXPECT_EQ(current.getSize(), 200);
+}
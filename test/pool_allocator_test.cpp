@@ -0,0 +1,153 @@
+#include <gtest/gtest.h>
+#include "../include/LinkedList.hpp"
+#include "../include/PoolAllocator.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+// Тесты пула узлов и LinkedList со статически диспетчеризуемыми аллокаторами
+class PoolAllocatorTest : public ::testing::Test {
+protected:
+    NodePool pool;
+    PoolAllocator<int> poolAlloc{&pool};
+
+    using ListType = LinkedList<int, PoolAllocator<int>>;
+};
+
+// ============ Тесты NodePool ============
+TEST_F(PoolAllocatorTest, ReusesFreedBlocks) {
+    void* first = pool.allocate(16);
+    pool.deallocate(first, 16);
+
+    void* second = pool.allocate(16);
+    EXPECT_EQ(first, second);
+}
+
+TEST_F(PoolAllocatorTest, SizeClassesDoNotMix) {
+    void* small = pool.allocate(16);
+    pool.deallocate(small, 16);
+
+    void* large = pool.allocate(64);
+    EXPECT_NE(small, large);
+}
+
+TEST_F(PoolAllocatorTest, LargeRequestsBypassPool) {
+    void* large = pool.allocate(NodePool::MAX_POOLED_SIZE + 1);
+    EXPECT_NE(large, nullptr);
+    pool.deallocate(large, NodePool::MAX_POOLED_SIZE + 1);
+}
+
+TEST_F(PoolAllocatorTest, AllocatorEquality) {
+    NodePool otherPool;
+    PoolAllocator<double> rebound(poolAlloc);
+
+    EXPECT_TRUE(poolAlloc == rebound);
+    EXPECT_FALSE(poolAlloc == PoolAllocator<int>(&otherPool));
+}
+
+// ============ LinkedList с PoolAllocator ============
+TEST_F(PoolAllocatorTest, ListBasicOperations) {
+    ListType list({1, 2, 3}, poolAlloc);
+
+    int v0 = 0, v4 = 4;
+    list.pushFront(v0);
+    list.pushBack(v4);
+
+    EXPECT_EQ(list.getSize(), 5);
+    for (int i = 0; i < 5; ++i) {
+        EXPECT_EQ(list[i].value, i);
+    }
+
+    EXPECT_EQ(list.popFront(), 0);
+    EXPECT_EQ(list.popBack(), 4);
+}
+
+TEST_F(PoolAllocatorTest, ListNodesComeFromPool) {
+    ListType list(poolAlloc);
+    int v = 1;
+
+    list.pushFront(v);
+    ListItem<int>* firstItem = &list[0];
+    list.popFront();
+
+    list.pushFront(v);
+    EXPECT_EQ(&list[0], firstItem);
+}
+
+TEST_F(PoolAllocatorTest, ListWithStrings) {
+    PoolAllocator<std::string> stringAlloc(&pool);
+    LinkedList<std::string, PoolAllocator<std::string>> list({"a", "b"}, stringAlloc);
+
+    std::string c = "c";
+    list.pushBack(c);
+
+    EXPECT_EQ(list[2].value, "c");
+    EXPECT_EQ(list.popFront(), "a");
+}
+
+TEST_F(PoolAllocatorTest, ListWithSlabPolicy) {
+    LinkedList<int, PoolAllocator<int>, SlabAllocation> list({1, 2, 3, 4}, poolAlloc);
+
+    EXPECT_EQ(&list[1], &list[0] + 1);
+    EXPECT_EQ(list.popFront(), 1);
+}
+
+TEST_F(PoolAllocatorTest, SpliceBetweenPoolLists) {
+    ListType list({1, 4}, poolAlloc);
+    ListType other({2, 3}, poolAlloc);
+
+    ListItem<int>* movedItem = &other[0];
+    list.spliceAfter(list.begin(), other);
+
+    EXPECT_EQ(&list[1], movedItem);
+    EXPECT_EQ(list.getSize(), 4);
+}
+
+// PoolAllocator передаётся при перемещении и обмене: узлы не копируются
+TEST_F(PoolAllocatorTest, MoveAssignBetweenPoolsTakesAllocator) {
+    NodePool otherPool;
+    ListType list({1, 2}, poolAlloc);
+    ListType other({3, 4, 5}, PoolAllocator<int>(&otherPool));
+
+    ListItem<int>* movedItem = &other[0];
+    list = std::move(other);
+
+    EXPECT_EQ(&list[0], movedItem);
+    EXPECT_EQ(list.getSize(), 3);
+    EXPECT_TRUE(other.isEmpty());
+
+    int v = 6;
+    list.pushBack(v);
+    EXPECT_EQ(list.popFront(), 3);
+}
+
+TEST_F(PoolAllocatorTest, SwapBetweenPoolsExchangesAllocators) {
+    NodePool otherPool;
+    ListType list({1, 2}, poolAlloc);
+    ListType other({3, 4, 5}, PoolAllocator<int>(&otherPool));
+
+    ListItem<int>* leftItem = &list[0];
+    ListItem<int>* rightItem = &other[0];
+    list.swap(other);
+
+    EXPECT_EQ(&list[0], rightItem);
+    EXPECT_EQ(&other[0], leftItem);
+    EXPECT_EQ(list.getSize(), 3);
+    EXPECT_EQ(other.getSize(), 2);
+}
+
+// ============ LinkedList с std::allocator ============
+TEST(StdAllocatorListTest, BasicOperations) {
+    LinkedList<int, std::allocator<int>> list({3, 1, 2});
+
+    list.sort();
+    int v = 4;
+    list.pushBack(v);
+
+    std::vector<int> values;
+    for (auto it = list.begin(); it != list.end(); ++it) {
+        values.push_back(*it);
+    }
+    EXPECT_EQ(values, (std::vector<int>{1, 2, 3, 4}));
+}